@@ -6,14 +6,23 @@
 
 #include "ArduinoJson/version.hpp"
 
+#include "ArduinoJson/Deserialization/splitJsonArray.hpp"
 #include "ArduinoJson/DynamicJsonBuffer.hpp"
+#include "ArduinoJson/JsonEvents.hpp"
 #include "ArduinoJson/JsonArray.hpp"
+#include "ArduinoJson/JsonLinesReader.hpp"
 #include "ArduinoJson/JsonObject.hpp"
+#include "ArduinoJson/JsonPushParser.hpp"
+#include "ArduinoJson/JsonValidation.hpp"
 #include "ArduinoJson/StaticJsonBuffer.hpp"
 
+#include "ArduinoJson/Data/JsonCompactorImpl.hpp"
+#include "ArduinoJson/Data/LazyJsonImpl.hpp"
+#include "ArduinoJson/Deserialization/JsonExtractorImpl.hpp"
 #include "ArduinoJson/Deserialization/JsonParserImpl.hpp"
 #include "ArduinoJson/JsonArrayImpl.hpp"
 #include "ArduinoJson/JsonBufferImpl.hpp"
+#include "ArduinoJson/JsonFilterImpl.hpp"
 #include "ArduinoJson/JsonObjectImpl.hpp"
 #include "ArduinoJson/JsonVariantImpl.hpp"
 #include "ArduinoJson/Serialization/JsonSerializerImpl.hpp"
@@ -44,6 +44,25 @@
 #define ARDUINOJSON_DEFAULT_NESTING_LIMIT 10
 #endif
 
+// Size of the buffer that holds the strings in parseJsonEvents()
+// (a longer string is passed to the handler in pieces)
+#ifndef ARDUINOJSON_EVENT_STRING_SIZE
+#define ARDUINOJSON_EVENT_STRING_SIZE 64
+#endif
+
+// Number of keys that the parser remembers, so that the repeated keys are
+// stored once in the JsonBuffer (0 to disable)
+#ifndef ARDUINOJSON_INTERNED_KEYS
+#define ARDUINOJSON_INTERNED_KEYS 8
+#endif
+
+// Number of keys past which the parser finds the duplicate keys of an object
+// in a temporary hash table, instead of searching the list (0 to disable).
+// The table is allocated on the heap, and freed at the end of the object.
+#ifndef ARDUINOJSON_PARSER_INDEX_THRESHOLD
+#define ARDUINOJSON_PARSER_INDEX_THRESHOLD 0
+#endif
+
 #else  // ARDUINOJSON_EMBEDDED_MODE
 
 // On a computer we have plenty of memory so we can use doubles
@@ -84,6 +103,21 @@
 #define ARDUINOJSON_DEFAULT_NESTING_LIMIT 50
 #endif
 
+// On a computer, the stack is large so we can read longer strings
+#ifndef ARDUINOJSON_EVENT_STRING_SIZE
+#define ARDUINOJSON_EVENT_STRING_SIZE 1024
+#endif
+
+// On a computer, we can remember more keys
+#ifndef ARDUINOJSON_INTERNED_KEYS
+#define ARDUINOJSON_INTERNED_KEYS 32
+#endif
+
+// On a computer, the heap is large enough for the table of a big object
+#ifndef ARDUINOJSON_PARSER_INDEX_THRESHOLD
+#define ARDUINOJSON_PARSER_INDEX_THRESHOLD 32
+#endif
+
 #endif  // ARDUINOJSON_EMBEDDED_MODE
 
 #ifdef ARDUINO
@@ -146,6 +180,39 @@
 #define ARDUINOJSON_NEGATIVE_EXPONENTIATION_THRESHOLD 1e-5
 #endif
 
+// Decode numbers, true, false and null while parsing, instead of keeping them
+// as strings that are converted every time they are read.
+// Doesn't use the JsonBuffer for these values, but as<char*>() only works for
+// actual strings.
+#ifndef ARDUINOJSON_EAGER_DECODING
+#define ARDUINOJSON_EAGER_DECODING 0
+#endif
+
+// Policy for the duplicate keys in the parsed objects:
+// 0 = the last value wins, like JsonObject::set()
+// 1 = trust the input, the pairs are appended without looking for the key
+// (a duplicate key gives a duplicate pair, and the first one wins on lookup)
+#ifndef ARDUINOJSON_ASSUME_UNIQUE_KEYS
+#define ARDUINOJSON_ASSUME_UNIQUE_KEYS 0
+#endif
+
+// Number of keys past which a JsonObject builds a hash table of its keys, so
+// that the lookups don't walk the list (0 to disable).
+// The table takes room in the JsonBuffer, which is not included in
+// JSON_OBJECT_SIZE() and validateJson().
+#ifndef ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+#define ARDUINOJSON_OBJECT_INDEX_THRESHOLD 0
+#endif
+
+// Number of elements past which a JsonArray builds a table of its nodes, so
+// that get(), set(), is(), remove() and operator[] don't walk the list
+// (0 to disable).
+// The table takes room in the JsonBuffer, which is not included in
+// JSON_ARRAY_SIZE() and validateJson().
+#ifndef ARDUINOJSON_ARRAY_INDEX_THRESHOLD
+#define ARDUINOJSON_ARRAY_INDEX_THRESHOLD 0
+#endif
+
 #if ARDUINOJSON_USE_LONG_LONG && ARDUINOJSON_USE_INT64
 #error ARDUINOJSON_USE_LONG_LONG and ARDUINOJSON_USE_INT64 cannot be set together
 #endif
@@ -0,0 +1,66 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../JsonBuffer.hpp"
+#include "../JsonVariant.hpp"
+#include "ListNode.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A table of the nodes of a JsonArray, in order, so that an element is found
+// without walking the list.
+// It's allocated in the JsonBuffer, like the nodes. When it's full, a bigger
+// one replaces it, and the old one is lost until the JsonBuffer is cleared.
+// This internal class is not indended to be used directly.
+// Instead, set ARDUINOJSON_ARRAY_INDEX_THRESHOLD.
+class JsonArrayIndex {
+ public:
+  typedef ListNode<JsonVariant> node_type;
+
+  // Returns NULL if the JsonBuffer is full
+  static JsonArrayIndex *create(JsonBuffer *buffer, size_t nodeCount) {
+    size_t capacity = 8;
+    while (capacity < 2 * nodeCount) capacity *= 2;
+    void *p = buffer->alloc(sizeof(JsonArrayIndex) +
+                            (capacity - 1) * sizeof(node_type *));
+    if (!p) return NULL;
+    JsonArrayIndex *index = static_cast<JsonArrayIndex *>(p);
+    index->_capacity = capacity;
+    index->_nodeCount = 0;
+    return index;
+  }
+
+  // Adds the nodes that were appended to the list since the last call.
+  // Returns false if the index is full, a bigger one must be created.
+  bool update(node_type *firstNode) {
+    node_type *node = _nodeCount ? _nodes[_nodeCount - 1]->next : firstNode;
+    for (; node; node = node->next) {
+      if (_nodeCount == _capacity) return false;
+      _nodes[_nodeCount++] = node;
+    }
+    return true;
+  }
+
+  // Returns the node at this position, or NULL
+  node_type *at(size_t index) const {
+    return index < _nodeCount ? _nodes[index] : NULL;
+  }
+
+  // Forgets all the nodes, because one was removed, or because they were
+  // moved to another array.
+  // They are added back by the next update().
+  void clear() {
+    _nodeCount = 0;
+  }
+
+ private:
+  size_t _capacity;
+  size_t _nodeCount;
+  node_type *_nodes[1];
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
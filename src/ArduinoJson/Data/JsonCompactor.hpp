@@ -0,0 +1,46 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../Configuration.hpp"
+#include "../JsonBuffer.hpp"
+#include "../JsonVariant.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Copies a tree of JsonArray and JsonObject, so that the nodes of each
+// container are contiguous in the JsonBuffer, followed by its strings and its
+// nested containers.
+// This internal class is not indended to be used directly.
+// Instead, use JsonBuffer::copyCompactly()
+class JsonCompactor {
+ public:
+  explicit JsonCompactor(JsonBuffer *buffer) : _buffer(buffer) {
+    for (size_t i = 0; i < KEY_CACHE_SIZE; i++) _keySources[i] = NULL;
+  }
+
+  JsonArray &copy(const JsonArray &source);
+  JsonObject &copy(const JsonObject &source);
+
+ private:
+  // the same keys are copied once, as long as they share the same pointer in
+  // the source (see ARDUINOJSON_INTERNED_KEYS)
+  enum {
+    KEY_CACHE_SIZE = ARDUINOJSON_INTERNED_KEYS > 0 ? ARDUINOJSON_INTERNED_KEYS
+                                                   : 1
+  };
+
+  // Copies the strings and the containers, the other values are already
+  // there.
+  bool copyValue(const JsonVariant &source, JsonVariant *destination);
+  const char *copyKey(const char *key);
+
+  JsonBuffer *_buffer;
+  const char *_keySources[KEY_CACHE_SIZE];
+  const char *_keyCopies[KEY_CACHE_SIZE];
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
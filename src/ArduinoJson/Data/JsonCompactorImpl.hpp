@@ -0,0 +1,102 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../JsonArray.hpp"
+#include "../JsonObject.hpp"
+#include "../StringTraits/StringTraits.hpp"
+#include "JsonCompactor.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+inline JsonArray &JsonCompactor::copy(const JsonArray &source) {
+  if (!source.success()) return JsonArray::invalid();
+  JsonArray &array = _buffer->createArray();
+  if (!array.success()) return JsonArray::invalid();
+
+  // all the nodes first, so that they are contiguous
+  JsonArray::const_iterator src;
+  for (src = source.begin(); src != source.end(); ++src) {
+    if (!array.add(*src)) return JsonArray::invalid();
+  }
+#if ARDUINOJSON_ARRAY_INDEX_THRESHOLD > 0
+  // then the index, if the array is big enough
+  array.index();
+#endif
+
+  JsonArray::iterator dst = array.begin();
+  for (src = source.begin(); src != source.end(); ++src, ++dst) {
+    if (!copyValue(*src, &*dst)) return JsonArray::invalid();
+  }
+  return array;
+}
+
+inline JsonObject &JsonCompactor::copy(const JsonObject &source) {
+  if (!source.success()) return JsonObject::invalid();
+  JsonObject &object = _buffer->createObject();
+  if (!object.success()) return JsonObject::invalid();
+
+  // all the nodes first, so that they are contiguous
+  // (the keys are unique already, so there is no need to search them)
+  JsonObject::const_iterator src;
+  for (src = source.begin(); src != source.end(); ++src) {
+    JsonObject::iterator it = object.add();
+    if (it == object.end()) return JsonObject::invalid();
+    *it = *src;
+  }
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD > 0
+  // then the index, if the object is big enough
+  object.index();
+#endif
+
+  JsonObject::iterator dst = object.begin();
+  for (src = source.begin(); src != source.end(); ++src, ++dst) {
+    dst->key = copyKey(src->key);
+    if (!dst->key) return JsonObject::invalid();
+    if (!copyValue(src->value, &dst->value)) return JsonObject::invalid();
+  }
+  return object;
+}
+
+inline bool JsonCompactor::copyValue(const JsonVariant &source,
+                                     JsonVariant *destination) {
+  switch (source._type) {
+    case JSON_STRING:
+    case JSON_UNPARSED:
+      if (!source._content.asString) return true;
+      destination->_content.asString =
+          StringTraits<const char *>::duplicate(source._content.asString,
+                                                _buffer);
+      return destination->_content.asString != NULL;
+
+    case JSON_ARRAY:
+    case JSON_OBJECT:
+    case JSON_LAZY:
+      // a lazy value is expanded in the JsonBuffer of the source
+      if (source.variantIsArray()) {
+        *destination = copy(source.variantAsArray());
+      } else {
+        *destination = copy(source.variantAsObject());
+      }
+      return destination->success();
+
+    default:
+      return true;
+  }
+}
+
+inline const char *JsonCompactor::copyKey(const char *key) {
+  size_t i = (reinterpret_cast<size_t>(key) / sizeof(void *)) % KEY_CACHE_SIZE;
+  if (_keySources[i] == key) return _keyCopies[i];
+  const char *copy = StringTraits<const char *>::duplicate(key, _buffer);
+  if (ARDUINOJSON_INTERNED_KEYS > 0 && copy) {
+    _keySources[i] = key;
+    _keyCopies[i] = copy;
+  }
+  return copy;
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -0,0 +1,140 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for strcmp
+
+#include "../JsonBuffer.hpp"
+#include "../JsonPair.hpp"
+#include "../StringTraits/StringTraits.hpp"
+#include "ListNode.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A hash table of the nodes of a JsonObject, so that a key is found without
+// walking the list (open addressing with linear probing).
+// It's allocated in the JsonBuffer, like the nodes. When it's full, a bigger
+// one replaces it, and the old one is lost until the JsonBuffer is cleared.
+// The parser also uses it to find duplicate keys, in a buffer of its own.
+// This internal class is not indended to be used directly.
+// Instead, set ARDUINOJSON_OBJECT_INDEX_THRESHOLD or
+// ARDUINOJSON_PARSER_INDEX_THRESHOLD.
+class JsonObjectIndex {
+ public:
+  typedef ListNode<JsonPair> node_type;
+
+  // Returns NULL if the JsonBuffer is full
+  static JsonObjectIndex *create(JsonBuffer *buffer, size_t nodeCount) {
+    size_t capacity = 8;
+    while (capacity < 4 * nodeCount) capacity *= 2;
+    void *p = buffer->alloc(sizeof(JsonObjectIndex) +
+                            (capacity - 1) * sizeof(node_type *));
+    if (!p) return NULL;
+    JsonObjectIndex *index = static_cast<JsonObjectIndex *>(p);
+    index->_capacity = capacity;
+    index->_nodeCount = 0;
+    index->_lastNode = NULL;
+    for (size_t i = 0; i < capacity; i++) index->_slots[i] = NULL;
+    return index;
+  }
+
+  // Adds the nodes that were appended to the list since the last call.
+  // Returns false if the index is full, a bigger one must be created.
+  bool update(node_type *firstNode) {
+    node_type *node = _lastNode ? _lastNode->next : firstNode;
+    for (; node; node = node->next) {
+      if (!insert(node)) return false;
+    }
+    return true;
+  }
+
+  // Returns the first node with this key, or NULL
+  template <typename TStringRef>
+  node_type *find(TStringRef key) const {
+    for (size_t i = slotOf(hash<TStringRef>(key)); _slots[i]; i = next(i)) {
+      if (StringTraits<TStringRef>::equals(key, _slots[i]->content.key))
+        return _slots[i];
+    }
+    return NULL;
+  }
+
+  // Forgets the pair, before it's removed from the list.
+  // Then, call removed() with the new state of the list.
+  void remove(const JsonPair *pair) {
+    size_t i = slotOf(hash<const char *>(pair->key));
+    while (_slots[i] && &_slots[i]->content != pair) i = next(i);
+    if (!_slots[i]) return;  // not in this object, or a duplicate key
+
+    // move back the nodes that can't be found anymore, so that there is no
+    // hole between their hash and their slot
+    for (size_t j = next(i); _slots[j]; j = next(j)) {
+      size_t k = slotOf(hash<const char *>(_slots[j]->content.key));
+      bool reachable = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+      if (reachable) continue;
+      _slots[i] = _slots[j];
+      i = j;
+    }
+    _slots[i] = NULL;
+  }
+
+  void removed(node_type *lastNode, size_t nodeCount) {
+    _lastNode = lastNode;
+    _nodeCount = nodeCount;
+  }
+
+  // Indexes a node whose key was hidden by a duplicate that was removed.
+  void restore(node_type *node) {
+    size_t i = slotOf(hash<const char *>(node->content.key));
+    while (_slots[i]) {
+      if (!strcmp(_slots[i]->content.key, node->content.key)) return;
+      i = next(i);
+    }
+    _slots[i] = node;
+  }
+
+  // Forgets all the nodes, because they were moved to another object.
+  // They are added back by the next update().
+  void clear() {
+    for (size_t i = 0; i < _capacity; i++) _slots[i] = NULL;
+    _nodeCount = 0;
+    _lastNode = NULL;
+  }
+
+ private:
+  template <typename TStringRef>
+  static size_t hash(TStringRef key) {
+    typename StringTraits<TStringRef>::Reader reader(key);
+    size_t h = 0;
+    for (; reader.current(); reader.move())
+      h = h * 31 + static_cast<unsigned char>(reader.current());
+    return h;
+  }
+
+  size_t slotOf(size_t h) const {
+    return h & (_capacity - 1);
+  }
+
+  size_t next(size_t i) const {
+    return (i + 1) & (_capacity - 1);
+  }
+
+  // A duplicate key is not indexed, so that the first pair wins, like in
+  // the list.
+  bool insert(node_type *node) {
+    if (2 * (_nodeCount + 1) > _capacity) return false;
+    _nodeCount++;
+    _lastNode = node;
+    restore(node);
+    return true;
+  }
+
+  size_t _capacity;  // a power of two
+  size_t _nodeCount;
+  node_type *_lastNode;
+  node_type *_slots[1];
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -14,6 +14,8 @@ class JsonArray;
 class JsonObject;
 
 namespace Internals {
+class LazyJson;
+
 // A union that defines the actual content of a JsonVariant.
 // The enum JsonVariantType determines which member is in use.
 union JsonVariantContent {
@@ -22,6 +24,7 @@ union JsonVariantContent {
   const char* asString;  // asString can be null
   JsonArray* asArray;    // asArray cannot be null
   JsonObject* asObject;  // asObject cannot be null
+  LazyJson* asLazy;      // asLazy cannot be null
 };
 }
 }
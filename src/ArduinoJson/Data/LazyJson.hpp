@@ -0,0 +1,63 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stdint.h>  // for uint8_t
+
+#include "../JsonBuffer.hpp"
+#include "../JsonVariant.hpp"
+#include "JsonBufferAllocated.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A nested array or object that is kept as text until it's accessed.
+// Created by JsonBuffer::parseArrayLazily() and parseObjectLazily().
+//
+// The text is a private copy (or the original in-place input), so it can be
+// parsed in place when expand() is called for the first time.
+// Before that, the serializer writes the text untouched.
+class LazyJson : public JsonBufferAllocated {
+ public:
+  LazyJson(JsonBuffer *buffer, char *json, uint8_t nestingLimit)
+      : _buffer(buffer),
+        _json(json),
+        _kind(json[0]),
+        _expanded(false),
+        _nestingLimit(nestingLimit) {}
+
+  bool isArray() const {
+    return _kind == '[';
+  }
+
+  bool isObject() const {
+    return _kind == '{';
+  }
+
+  bool isExpanded() const {
+    return _expanded;
+  }
+
+  // The original text, only valid until the first call to expand()
+  const char *json() const {
+    return _json;
+  }
+
+  // Parses the text (the first time only) and returns the JsonArray or the
+  // JsonObject, whose nested values are lazy too.
+  // Returns an undefined variant if the text is invalid or if the JsonBuffer
+  // is full.
+  JsonVariant expand();
+
+ private:
+  JsonBuffer *_buffer;
+  char *_json;
+  JsonVariant _value;
+  char _kind;
+  bool _expanded;
+  uint8_t _nestingLimit;
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
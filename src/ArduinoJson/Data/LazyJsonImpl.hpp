@@ -0,0 +1,22 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../Deserialization/JsonParser.hpp"
+#include "../JsonArray.hpp"
+#include "../JsonObject.hpp"
+#include "LazyJson.hpp"
+
+inline ArduinoJson::JsonVariant ArduinoJson::Internals::LazyJson::expand() {
+  if (!_expanded) {
+    // the text is modified in place, so there is no second chance
+    _expanded = true;
+    if (isArray())
+      _value = makeParser(_buffer, _json, _nestingLimit).parseArrayLazily();
+    else
+      _value = makeParser(_buffer, _json, _nestingLimit).parseObjectLazily();
+  }
+  return _value;
+}
@@ -13,6 +13,8 @@ namespace Internals {
 
 // A singly linked list of T.
 // The linked list is composed of ListNode<T>.
+// It keeps a pointer to the last node and the number of nodes, so that add()
+// and size() take constant time.
 // It is derived by JsonArray and JsonObject
 template <typename T>
 class List {
@@ -27,7 +29,8 @@ class List {
   // When buffer is NULL, the List is not able to grow and success() returns
   // false. This is used to identify bad memory allocations and parsing
   // failures.
-  explicit List(JsonBuffer *buffer) : _buffer(buffer), _firstNode(NULL) {}
+  explicit List(JsonBuffer *buffer)
+      : _buffer(buffer), _firstNode(NULL), _lastNode(NULL), _nodeCount(0) {}
 
   // Returns true if the object is valid
   // Would return false in the following situation:
@@ -40,21 +43,19 @@ class List {
   // Returns the numbers of elements in the list.
   // For a JsonObject, it would return the number of key-value pairs
   size_t size() const {
-    size_t nodeCount = 0;
-    for (node_type *node = _firstNode; node; node = node->next) nodeCount++;
-    return nodeCount;
+    return _nodeCount;
   }
 
   iterator add() {
     node_type *newNode = new (_buffer) node_type();
+    if (!newNode) return iterator(NULL);
 
-    if (_firstNode) {
-      node_type *lastNode = _firstNode;
-      while (lastNode->next) lastNode = lastNode->next;
-      lastNode->next = newNode;
-    } else {
+    if (_lastNode)
+      _lastNode->next = newNode;
+    else
       _firstNode = newNode;
-    }
+    _lastNode = newNode;
+    _nodeCount++;
 
     return iterator(newNode);
   }
@@ -76,19 +77,54 @@ class List {
   void remove(iterator it) {
     node_type *nodeToRemove = it._node;
     if (!nodeToRemove) return;
-    if (nodeToRemove == _firstNode) {
-      _firstNode = nodeToRemove->next;
+    node_type *previousNode = NULL;
+    if (nodeToRemove != _firstNode) {
+      previousNode = _firstNode;
+      while (previousNode && previousNode->next != nodeToRemove)
+        previousNode = previousNode->next;
+      if (!previousNode) return;  // not in this list
+      previousNode->next = nodeToRemove->next;
     } else {
-      for (node_type *node = _firstNode; node; node = node->next)
-        if (node->next == nodeToRemove) node->next = nodeToRemove->next;
+      _firstNode = nodeToRemove->next;
     }
+    if (nodeToRemove == _lastNode) _lastNode = previousNode;
+    _nodeCount--;
+  }
+
+  // Moves the nodes of another list to the end of this one, the other list
+  // becomes empty.
+  // The nodes are not copied, so they stay in the JsonBuffer of the other list,
+  // which must live as long as this list.
+  // Nothing moves if either list is invalid, so that the nodes don't end up
+  // in the shared invalid() instance.
+  void splice(List &other) {
+    if (&other == this || !other._firstNode) return;
+    if (!success() || !other.success()) return;
+    if (_lastNode)
+      _lastNode->next = other._firstNode;
+    else
+      _firstNode = other._firstNode;
+    _lastNode = other._lastNode;
+    _nodeCount += other._nodeCount;
+    other._firstNode = NULL;
+    other._lastNode = NULL;
+    other._nodeCount = 0;
   }
 
  protected:
+  node_type *firstNode() const {
+    return _firstNode;
+  }
+  node_type *lastNode() const {
+    return _lastNode;
+  }
+
   JsonBuffer *_buffer;
 
  private:
   node_type *_firstNode;
+  node_type *_lastNode;
+  size_t _nodeCount;
 };
 }
 }
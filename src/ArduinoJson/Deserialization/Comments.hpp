@@ -4,10 +4,16 @@
 
 #pragma once
 
+#include <string.h>  // for strchr, strspn, strstr
+
+#include "../StringTraits/StringTraits.hpp"
+#include "../TypeTraits/EnableIf.hpp"
+
 namespace ArduinoJson {
 namespace Internals {
 template <typename TInput>
-void skipSpacesAndComments(TInput& input) {
+typename EnableIf<!IsContiguousReader<TInput>::value>::type
+skipSpacesAndComments(TInput& input) {
   for (;;) {
     switch (input.current()) {
       // spaces
@@ -57,5 +63,56 @@ void skipSpacesAndComments(TInput& input) {
     }
   }
 }
+
+// Same as above, but for a null-terminated string in RAM.
+// Runs of spaces and comment bodies are skipped with the string functions,
+// which the standard library implements a word (or a vector) at a time.
+inline const char* skipSpacesAndComments(const char* s) {
+  for (;;) {
+    switch (*s) {
+      // spaces
+      case ' ':
+      case '\t':
+      case '\r':
+      case '\n':
+        s += strspn(s + 1, " \t\r\n") + 1;
+        continue;
+
+      // comments
+      case '/':
+        switch (s[1]) {
+          // C-style block comment
+          case '*': {
+            const char* end = strstr(s + 2, "*/");
+            if (!end) return s + strlen(s);
+            s = end + 2;
+            break;
+          }
+
+          // C++-style line comment
+          case '/': {
+            const char* end = strchr(s + 2, '\n');
+            if (!end) return s + strlen(s);
+            s = end;
+            break;
+          }
+
+          // not a comment, just a '/'
+          default:
+            return s;
+        }
+        break;
+
+      default:
+        return s;
+    }
+  }
+}
+
+template <typename TInput>
+typename EnableIf<IsContiguousReader<TInput>::value>::type
+skipSpacesAndComments(TInput& input) {
+  input.jump(skipSpacesAndComments(input.ptr()));
+}
 }
 }
@@ -0,0 +1,82 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for strcmp
+
+#include "../Data/JsonObjectIndex.hpp"
+#include "../DynamicJsonBuffer.hpp"
+#include "../JsonObject.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Returns the pair with this key, or NULL
+inline JsonPair *findPairInList(JsonObject &object, const char *key) {
+  for (JsonObject::iterator it = object.begin(); it != object.end(); ++it) {
+    if (!strcmp(it->key, key)) return &*it;
+  }
+  return NULL;
+}
+
+// Finds the keys that are already in the object being parsed.
+// Past THRESHOLD keys, it uses a hash table instead of searching the list.
+// The table lives in a DynamicJsonBuffer of its own, which is freed at the
+// end of the object, so that the JsonBuffer of the document doesn't pay for
+// it, and validateJson() stays exact.
+// This internal class is not indended to be used directly.
+// Instead, set ARDUINOJSON_PARSER_INDEX_THRESHOLD.
+template <size_t THRESHOLD>
+class DuplicateKeyFinder {
+ public:
+  explicit DuplicateKeyFinder(JsonObject &object)
+      : _object(object), _index(NULL) {}
+
+  // Returns the pair with this key, or NULL
+  JsonPair *find(const char *key) {
+    if (!index()) return findPairInList(_object, key);
+    JsonObjectIndex::node_type *node = _index->find<const char *>(key);
+    return node ? &node->content : NULL;
+  }
+
+ private:
+  DuplicateKeyFinder &operator=(const DuplicateKeyFinder &);  // non-copiable
+
+  // Same as JsonObject::index(), but a full table is freed before the
+  // bigger one is created, since nothing else lives in the scratch buffer.
+  // Returns NULL if the object is small, or if the heap is full.
+  JsonObjectIndex *index() {
+    if (_index && !_index->update(_object.firstNode())) _index = NULL;
+    if (!_index && _object.size() > THRESHOLD) {
+      _scratch.clear();
+      _index = JsonObjectIndex::create(&_scratch, _object.size());
+      if (_index && !_index->update(_object.firstNode())) _index = NULL;
+    }
+    return _index;
+  }
+
+  JsonObject &_object;
+  DynamicJsonBuffer _scratch;
+  JsonObjectIndex *_index;
+};
+
+// With a threshold of 0, the list is always searched, and nothing is
+// allocated.
+template <>
+class DuplicateKeyFinder<0> {
+ public:
+  explicit DuplicateKeyFinder(JsonObject &object) : _object(object) {}
+
+  JsonPair *find(const char *key) {
+    return findPairInList(_object, key);
+  }
+
+ private:
+  DuplicateKeyFinder &operator=(const DuplicateKeyFinder &);  // non-copiable
+
+  JsonObject &_object;
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
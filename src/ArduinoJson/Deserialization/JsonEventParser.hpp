@@ -0,0 +1,221 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stdint.h>  // for uint8_t
+#include <string.h>  // for strcmp, strlen
+
+#include "../Configuration.hpp"
+#include "../Polyfills/isFloat.hpp"
+#include "../Polyfills/isInteger.hpp"
+#include "../StringTraits/StringTraits.hpp"
+#include "../TypeTraits/IsConst.hpp"
+#include "Comments.hpp"
+#include "ScratchStringWriter.hpp"
+#include "StringWriter.hpp"
+#include "readString.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Passes the beginning of a key or a string that doesn't fit in the
+// ScratchStringWriter to the handler; the end goes to onKey() or onString().
+template <typename THandler>
+class JsonEventPieces {
+ public:
+  JsonEventPieces(THandler *handler, bool isKey)
+      : _handler(handler), _isKey(isKey), _split(false) {}
+
+  bool operator()(const char *s, size_t n) {
+    _split = true;
+    return _isKey ? _handler->onKeyPart(s, n) : _handler->onStringPart(s, n);
+  }
+
+  // Tells whether the beginning of the string went to the handler already
+  bool split() const {
+    return _split;
+  }
+
+ private:
+  THandler *_handler;
+  bool _isKey;
+  bool _split;
+};
+
+// The strings modified in place always fit, there are no pieces
+template <typename TWriter, typename TPieces>
+typename TWriter::String startEventString(TWriter &writer, TPieces &) {
+  return writer.startString();
+}
+
+template <size_t CAPACITY, typename TPieces>
+typename ScratchStringWriter<CAPACITY>::String startEventString(
+    ScratchStringWriter<CAPACITY> &writer, TPieces &pieces) {
+  return writer.startString(pieces);
+}
+
+// Parse a JSON string and calls the handler for each token, without building
+// JsonArrays and JsonObjects.
+// This internal class is not indended to be used directly.
+// Instead, use parseJsonEvents()
+template <typename TReader, typename TWriter, typename THandler>
+class JsonEventParser {
+ public:
+  JsonEventParser(TReader reader, TWriter writer, THandler &handler,
+                  uint8_t nestingLimit)
+      : _reader(reader),
+        _writer(writer),
+        _handler(&handler),
+        _nestingLimit(nestingLimit) {}
+
+  bool parse() {
+    return parseAnything();
+  }
+
+ private:
+  bool eat(char charToSkip) {
+    skipSpacesAndComments(_reader);
+    if (_reader.current() != charToSkip) return false;
+    _reader.move();
+    return true;
+  }
+
+  bool parseAnything() {
+    skipSpacesAndComments(_reader);
+
+    switch (_reader.current()) {
+      case '[':
+        return parseArray();
+
+      case '{':
+        return parseObject();
+
+      default:
+        return parseValue();
+    }
+  }
+
+  bool parseArray() {
+    if (_nestingLimit == 0) return false;
+    _nestingLimit--;
+
+    _reader.move();  // skip '['
+    if (!_handler->onStartArray()) return false;
+    if (eat(']')) goto END_ARRAY;
+
+    // Read each value
+    for (;;) {
+      // 1 - Parse value
+      if (!parseAnything()) return false;
+
+      // 2 - More values?
+      if (eat(']')) goto END_ARRAY;
+      if (!eat(',')) return false;
+    }
+
+  END_ARRAY:
+    _nestingLimit++;
+    return _handler->onEndArray();
+  }
+
+  bool parseObject() {
+    if (_nestingLimit == 0) return false;
+    _nestingLimit--;
+
+    _reader.move();  // skip '{'
+    if (!_handler->onStartObject()) return false;
+    if (eat('}')) goto END_OBJECT;
+
+    // Read each key value pair
+    for (;;) {
+      // 1 - Parse key
+      if (!parseKey()) return false;
+      if (!eat(':')) return false;
+
+      // 2 - Parse value
+      if (!parseAnything()) return false;
+
+      // 3 - More keys/values?
+      if (eat('}')) goto END_OBJECT;
+      if (!eat(',')) return false;
+    }
+
+  END_OBJECT:
+    _nestingLimit++;
+    return _handler->onEndObject();
+  }
+
+  bool parseKey() {
+    JsonEventPieces<THandler> pieces(_handler, true);
+    typename TWriter::String str = startEventString(_writer, pieces);
+    skipSpacesAndComments(_reader);
+    readString(_reader, str);
+    const char *key = str.c_str();
+    if (key == NULL) return false;
+    return _handler->onKey(key, strlen(key));
+  }
+
+  bool parseValue() {
+    bool hasQuotes = isQuote(_reader.current());
+    JsonEventPieces<THandler> pieces(_handler, false);
+    typename TWriter::String str = startEventString(_writer, pieces);
+    readString(_reader, str);
+    const char *value = str.c_str();
+    if (value == NULL) return false;
+    size_t length = strlen(value);
+
+    // a value without quotes that doesn't fit is not a literal either
+    if (hasQuotes || pieces.split()) return _handler->onString(value, length);
+    // numbers are passed as text, the handler only converts those it needs
+    if (isInteger(value) || isFloat(value))
+      return _handler->onNumber(value, length);
+    if (!strcmp(value, "true")) return _handler->onBool(true);
+    if (!strcmp(value, "false")) return _handler->onBool(false);
+    if (!strcmp(value, "null")) return _handler->onNull();
+    // JsonParser accepts strings without quotes, so we do the same
+    return _handler->onString(value, length);
+  }
+
+  TReader _reader;
+  TWriter _writer;
+  THandler *_handler;
+  uint8_t _nestingLimit;
+};
+
+template <typename TString, typename THandler, typename Enable = void>
+struct JsonEventParserBuilder {
+  typedef typename StringTraits<TString>::Reader TReader;
+  typedef ScratchStringWriter<ARDUINOJSON_EVENT_STRING_SIZE> TWriter;
+  typedef JsonEventParser<TReader, TWriter, THandler> TParser;
+
+  static TParser makeParser(TString &json, THandler &handler,
+                            uint8_t nestingLimit) {
+    return TParser(TReader(json), TWriter(), handler, nestingLimit);
+  }
+};
+
+// Strings are unescaped in place, like JsonBuffer::parse() does
+template <typename TChar, typename THandler>
+struct JsonEventParserBuilder<
+    TChar *, THandler, typename EnableIf<!IsConst<TChar>::value>::type> {
+  typedef typename StringTraits<TChar *>::Reader TReader;
+  typedef StringWriter<TChar> TWriter;
+  typedef JsonEventParser<TReader, TWriter, THandler> TParser;
+
+  static TParser makeParser(TChar *json, THandler &handler,
+                            uint8_t nestingLimit) {
+    return TParser(TReader(json), TWriter(json), handler, nestingLimit);
+  }
+};
+
+template <typename TString, typename THandler>
+inline bool parseJsonEvents(TString &json, THandler &handler,
+                            uint8_t nestingLimit) {
+  return JsonEventParserBuilder<TString, THandler>::makeParser(json, handler,
+                                                               nestingLimit)
+      .parse();
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -0,0 +1,239 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../JsonBuffer.hpp"
+#include "../JsonVariant.hpp"
+#include "../TypeTraits/IsConst.hpp"
+#include "Comments.hpp"
+#include "JsonPointer.hpp"
+#include "StringWriter.hpp"
+#include "decodeLiteral.hpp"
+#include "parseLazyTo.hpp"
+#include "readString.hpp"
+#include "skipValue.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Finds the values designated by a set of JSON Pointers in a single pass.
+// Only the matching values are stored in the JsonBuffer, the rest is skipped,
+// and the parsing stops as soon as all the pointers are resolved.
+// This internal class is not indended to be used directly.
+// Instead, use JsonBuffer.extract()
+template <typename TReader, typename TWriter>
+class JsonExtractor {
+ public:
+  JsonExtractor(JsonBuffer *buffer, TReader reader, TWriter writer,
+                uint8_t nestingLimit)
+      : _buffer(buffer),
+        _reader(reader),
+        _writer(writer),
+        _nestingLimit(nestingLimit) {}
+
+  // Returns false if the input is invalid before all pointers are resolved.
+  // The values that are not found are left undefined.
+  bool extract(const char *const *pointers, JsonVariant *values,
+               size_t count) {
+    _pointers = pointers;
+    _values = values;
+    _remaining = 0;
+    for (size_t i = 0; i < count; i++) {
+      values[i] = JsonVariant();  // the extra pointers stay undefined
+      if (i < JsonPointerKeyMatcher::MAX_POINTERS &&
+          JsonPointer::depth(pointers[i]) >= 0)
+        _remaining |= bit(i);
+    }
+    return !_remaining || extractValue(_remaining, 0);
+  }
+
+ private:
+  JsonExtractor &operator=(const JsonExtractor &);  // non-copiable
+
+  static uint32_t bit(size_t i) {
+    return uint32_t(1) << i;
+  }
+
+  bool eat(char charToSkip) {
+    skipSpacesAndComments(_reader);
+    if (_reader.current() != charToSkip) return false;
+    _reader.move();
+    return true;
+  }
+
+  // The pointers in the mask match the path of the current value
+  bool extractValue(uint32_t mask, int depth) {
+    skipSpacesAndComments(_reader);
+
+    uint32_t deeper = 0;
+    for (size_t i = 0; i < JsonPointerKeyMatcher::MAX_POINTERS; i++) {
+      if ((mask & bit(i)) && JsonPointer::depth(_pointers[i]) > depth)
+        deeper |= bit(i);
+    }
+
+    if (deeper != mask) return storeValue(mask, deeper, depth);
+
+    switch (_reader.current()) {
+      case '[':
+        return extractArray(mask, depth);
+
+      case '{':
+        return extractObject(mask, depth);
+
+      default:
+        // the pointers go deeper than this value
+        return skipValue(_reader);
+    }
+  }
+
+  bool extractArray(uint32_t mask, int depth) {
+    if (_nestingLimit == 0) return false;
+    _nestingLimit--;
+
+    _reader.move();  // skip '['
+    if (eat(']')) goto END_ARRAY;
+
+    // the tokens are read once, instead of comparing them to each index
+    for (size_t i = 0; i < JsonPointerKeyMatcher::MAX_POINTERS; i++) {
+      if ((mask & bit(i)) &&
+          !JsonPointer::arrayIndex(_pointers[i], depth, _indexes[i]))
+        mask &= ~bit(i);
+    }
+
+    for (size_t index = 0;; index++) {
+      uint32_t childMask = 0;
+      for (size_t i = 0; i < JsonPointerKeyMatcher::MAX_POINTERS; i++) {
+        if ((mask & _remaining & bit(i)) && _indexes[i] == index)
+          childMask |= bit(i);
+      }
+      // the nested arrays overwrite _indexes, but these pointers are done
+      // with this array anyway
+      mask &= ~childMask;
+      if (!extractChild(childMask, depth)) return false;
+      if (!_remaining) return true;  // stop here
+
+      if (eat(']')) goto END_ARRAY;
+      if (!eat(',')) return false;
+    }
+
+  END_ARRAY:
+    _nestingLimit++;
+    return true;
+  }
+
+  bool extractObject(uint32_t mask, int depth) {
+    if (_nestingLimit == 0) return false;
+    _nestingLimit--;
+
+    _reader.move();  // skip '{'
+    if (eat('}')) goto END_OBJECT;
+
+    for (;;) {
+      // the key is compared with the pointers as it's read
+      skipSpacesAndComments(_reader);
+      JsonPointerKeyMatcher matcher(_pointers, mask & _remaining, depth);
+      readString(_reader, matcher);
+      if (!eat(':')) return false;
+
+      if (!extractChild(matcher.mask(), depth)) return false;
+      if (!_remaining) return true;  // stop here
+
+      if (eat('}')) goto END_OBJECT;
+      if (!eat(',')) return false;
+    }
+
+  END_OBJECT:
+    _nestingLimit++;
+    return true;
+  }
+
+  bool extractChild(uint32_t mask, int depth) {
+    if (mask) return extractValue(mask, depth + 1);
+    return skipValue(_reader);
+  }
+
+  // Stores the value for the pointers that end here, and resolves the ones
+  // that go deeper in the stored value.
+  bool storeValue(uint32_t mask, uint32_t deeper, int depth) {
+    JsonVariant value;
+    if (!parseValueTo(&value)) return false;
+
+    for (size_t i = 0; i < JsonPointerKeyMatcher::MAX_POINTERS; i++) {
+      if (!(mask & bit(i))) continue;
+      _values[i] = (deeper & bit(i)) ? resolve(value, _pointers[i], depth)
+                                     : value;
+      _remaining &= ~bit(i);
+    }
+    return true;
+  }
+
+  // Arrays and objects are stored as LazyJson, so that only the part that is
+  // accessed is parsed
+  bool parseValueTo(JsonVariant *destination) {
+    char c = _reader.current();
+    if (c == '[' || c == '{')
+      return parseLazyTo(_reader, _writer, _buffer, _nestingLimit, destination);
+
+    typename RemoveReference<TWriter>::type::String str = _writer.startString();
+    readString(_reader, str);
+    const char *value = str.c_str();
+    if (value == NULL) return false;
+    if (isQuote(c)) {
+      *destination = value;
+    } else {
+#if ARDUINOJSON_EAGER_DECODING
+      if (!decodeLiteral(value, destination))
+#endif
+        *destination = RawJson(value);
+    }
+    return true;
+  }
+
+  // Finds the rest of the pointer in a stored value
+  static JsonVariant resolve(JsonVariant value, const char *pointer,
+                             int depth);
+
+  JsonBuffer *_buffer;
+  TReader _reader;
+  TWriter _writer;
+  uint8_t _nestingLimit;
+  const char *const *_pointers;
+  JsonVariant *_values;
+  uint32_t _remaining;
+  size_t _indexes[JsonPointerKeyMatcher::MAX_POINTERS];
+};
+
+template <typename TJsonBuffer, typename TString, typename Enable = void>
+struct JsonExtractorBuilder {
+  typedef typename StringTraits<TString>::Reader TReader;
+  typedef JsonExtractor<TReader, TJsonBuffer &> TExtractor;
+
+  static TExtractor makeExtractor(TJsonBuffer *buffer, TString &json,
+                                  uint8_t nestingLimit) {
+    return TExtractor(buffer, TReader(json), *buffer, nestingLimit);
+  }
+};
+
+template <typename TJsonBuffer, typename TChar>
+struct JsonExtractorBuilder<TJsonBuffer, TChar *,
+                            typename EnableIf<!IsConst<TChar>::value>::type> {
+  typedef typename StringTraits<TChar *>::Reader TReader;
+  typedef StringWriter<TChar> TWriter;
+  typedef JsonExtractor<TReader, TWriter> TExtractor;
+
+  static TExtractor makeExtractor(TJsonBuffer *buffer, TChar *json,
+                                  uint8_t nestingLimit) {
+    return TExtractor(buffer, TReader(json), TWriter(json), nestingLimit);
+  }
+};
+
+template <typename TJsonBuffer, typename TString>
+inline typename JsonExtractorBuilder<TJsonBuffer, TString>::TExtractor
+makeExtractor(TJsonBuffer *buffer, TString &json, uint8_t nestingLimit) {
+  return JsonExtractorBuilder<TJsonBuffer, TString>::makeExtractor(
+      buffer, json, nestingLimit);
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -0,0 +1,39 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../JsonArray.hpp"
+#include "../JsonObject.hpp"
+#include "JsonExtractor.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+template <typename TReader, typename TWriter>
+inline JsonVariant JsonExtractor<TReader, TWriter>::resolve(
+    JsonVariant value, const char *pointer, int depth) {
+  int end = JsonPointer::depth(pointer);
+  for (; depth < end && value.success(); depth++) {
+    JsonVariant child;
+    if (value.is<JsonObject>()) {
+      JsonObject &object = value.as<JsonObject>();
+      for (JsonObject::iterator it = object.begin(); it != object.end();
+           ++it) {
+        if (JsonPointer::matches(pointer, depth, it->key)) {
+          child = it->value;
+          break;
+        }
+      }
+    } else if (value.is<JsonArray>()) {
+      size_t index;
+      if (JsonPointer::arrayIndex(pointer, depth, index))
+        child = value.as<JsonArray>().get<JsonVariant>(index);
+    }
+    value = child;
+  }
+  return value;
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -4,9 +4,13 @@
 
 #pragma once
 
+#include "../Configuration.hpp"
 #include "../JsonBuffer.hpp"
+#include "../JsonFilter.hpp"
 #include "../JsonVariant.hpp"
 #include "../TypeTraits/IsConst.hpp"
+#include "CharClasses.hpp"
+#include "KeyInterner.hpp"
 #include "StringWriter.hpp"
 
 namespace ArduinoJson {
@@ -23,17 +27,29 @@ class JsonParser {
       : _buffer(buffer),
         _reader(reader),
         _writer(writer),
-        _nestingLimit(nestingLimit) {}
+        _nestingLimit(nestingLimit),
+        _lazy(false) {}
 
-  JsonArray &parseArray();
-  JsonObject &parseObject();
+  JsonArray &parseArray(const JsonFilter &filter = JsonFilter::all());
+  JsonObject &parseObject(const JsonFilter &filter = JsonFilter::all());
 
-  JsonVariant parseVariant() {
+  JsonVariant parseVariant(const JsonFilter &filter = JsonFilter::all()) {
     JsonVariant result;
-    parseAnythingTo(&result);
+    parseAnythingTo(&result, filter);
     return result;
   }
 
+  // Same as parseArray() and parseObject(), but the nested arrays and objects
+  // are stored as LazyJson
+  JsonArray &parseArrayLazily() {
+    _lazy = true;
+    return parseArray();
+  }
+  JsonObject &parseObjectLazily() {
+    _lazy = true;
+    return parseObject();
+  }
+
  private:
   JsonParser &operator=(const JsonParser &);  // non-copiable
 
@@ -43,29 +59,30 @@ class JsonParser {
   }
 
   const char *parseString();
-  bool parseAnythingTo(JsonVariant *destination);
+  const char *parseKey();
+  bool parseAnythingTo(JsonVariant *destination, const JsonFilter &filter);
 
-  inline bool parseArrayTo(JsonVariant *destination);
-  inline bool parseObjectTo(JsonVariant *destination);
+  inline bool parseArrayTo(JsonVariant *destination, const JsonFilter &filter);
+  inline bool parseObjectTo(JsonVariant *destination,
+                            const JsonFilter &filter);
   inline bool parseStringTo(JsonVariant *destination);
-
-  static inline bool isBetween(char c, char min, char max) {
-    return min <= c && c <= max;
-  }
-
-  static inline bool canBeInNonQuotedString(char c) {
-    return isBetween(c, '0', '9') || isBetween(c, '_', 'z') ||
-           isBetween(c, 'A', 'Z') || c == '+' || c == '-' || c == '.';
-  }
-
-  static inline bool isQuote(char c) {
-    return c == '\'' || c == '\"';
-  }
+  inline bool parseLazyTo(JsonVariant *destination);
+#if ARDUINOJSON_EAGER_DECODING
+  inline bool parseLiteralTo(JsonVariant *destination);
+#endif
+  inline bool skipValue();
+  template <typename TKeyFinder>
+  inline bool addMember(JsonObject &object, TKeyFinder &keys,
+                        const char *key, const JsonVariant &value);
 
   JsonBuffer *_buffer;
   TReader _reader;
   TWriter _writer;
   uint8_t _nestingLimit;
+  bool _lazy;
+  // the keys are not interned when the strings stay in the input
+  KeyInterner<IsStringWriter<TWriter>::value ? 0 : ARDUINOJSON_INTERNED_KEYS>
+      _keys;
 };
 
 template <typename TJsonBuffer, typename TString, typename Enable = void>
@@ -5,7 +5,12 @@
 #pragma once
 
 #include "Comments.hpp"
+#include "DuplicateKeyFinder.hpp"
 #include "JsonParser.hpp"
+#include "decodeLiteral.hpp"
+#include "parseLazyTo.hpp"
+#include "readString.hpp"
+#include "skipValue.hpp"
 
 template <typename TReader, typename TWriter>
 inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::eat(
@@ -19,15 +24,17 @@ inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::eat(
 template <typename TReader, typename TWriter>
 inline bool
 ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseAnythingTo(
-    JsonVariant *destination) {
+    JsonVariant *destination, const JsonFilter &filter) {
   skipSpacesAndComments(_reader);
 
   switch (_reader.current()) {
     case '[':
-      return parseArrayTo(destination);
+      if (_lazy) return parseLazyTo(destination);
+      return parseArrayTo(destination, filter);
 
     case '{':
-      return parseObjectTo(destination);
+      if (_lazy) return parseLazyTo(destination);
+      return parseObjectTo(destination, filter);
 
     default:
       return parseStringTo(destination);
@@ -36,12 +43,14 @@ ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseAnythingTo(
 
 template <typename TReader, typename TWriter>
 inline ArduinoJson::JsonArray &
-ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseArray() {
+ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseArray(
+    const JsonFilter &filter) {
   if (_nestingLimit == 0) return JsonArray::invalid();
   _nestingLimit--;
 
   // Create an empty array
   JsonArray &array = _buffer->createArray();
+  JsonFilter elementFilter = filter.elements();
 
   // Check opening braket
   if (!eat('[')) goto ERROR_MISSING_BRACKET;
@@ -50,9 +59,13 @@ ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseArray() {
   // Read each value
   for (;;) {
     // 1 - Parse value
-    JsonVariant value;
-    if (!parseAnythingTo(&value)) goto ERROR_INVALID_VALUE;
-    if (!array.add(value)) goto ERROR_NO_MEMORY;
+    if (elementFilter.allow()) {
+      JsonVariant value;
+      if (!parseAnythingTo(&value, elementFilter)) goto ERROR_INVALID_VALUE;
+      if (!array.add(value)) goto ERROR_NO_MEMORY;
+    } else {
+      if (!skipValue()) goto ERROR_INVALID_VALUE;
+    }
 
     // 2 - More values?
     if (eat(']')) goto SUCCES_NON_EMPTY_ARRAY;
@@ -73,8 +86,8 @@ ERROR_NO_MEMORY:
 
 template <typename TReader, typename TWriter>
 inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseArrayTo(
-    JsonVariant *destination) {
-  JsonArray &array = parseArray();
+    JsonVariant *destination, const JsonFilter &filter) {
+  JsonArray &array = parseArray(filter);
   if (!array.success()) return false;
 
   *destination = array;
@@ -83,12 +96,17 @@ inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseArrayTo(
 
 template <typename TReader, typename TWriter>
 inline ArduinoJson::JsonObject &
-ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseObject() {
+ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseObject(
+    const JsonFilter &filter) {
   if (_nestingLimit == 0) return JsonObject::invalid();
   _nestingLimit--;
 
   // Create an empty object
   JsonObject &object = _buffer->createObject();
+  DuplicateKeyFinder<ARDUINOJSON_ASSUME_UNIQUE_KEYS
+                         ? 0
+                         : ARDUINOJSON_PARSER_INDEX_THRESHOLD>
+      keys(object);
 
   // Check opening brace
   if (!eat('{')) goto ERROR_MISSING_BRACE;
@@ -97,14 +115,19 @@ ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseObject() {
   // Read each key value pair
   for (;;) {
     // 1 - Parse key
-    const char *key = parseString();
+    const char *key = parseKey();
     if (!key) goto ERROR_INVALID_KEY;
     if (!eat(':')) goto ERROR_MISSING_COLON;
 
     // 2 - Parse value
-    JsonVariant value;
-    if (!parseAnythingTo(&value)) goto ERROR_INVALID_VALUE;
-    if (!object.set(key, value)) goto ERROR_NO_MEMORY;
+    JsonFilter memberFilter = filter[key];
+    if (memberFilter.allow()) {
+      JsonVariant value;
+      if (!parseAnythingTo(&value, memberFilter)) goto ERROR_INVALID_VALUE;
+      if (!addMember(object, keys, key, value)) goto ERROR_NO_MEMORY;
+    } else {
+      if (!skipValue()) goto ERROR_INVALID_VALUE;
+    }
 
     // 3 - More keys/values?
     if (eat('}')) goto SUCCESS_NON_EMPTY_OBJECT;
@@ -125,10 +148,35 @@ ERROR_NO_MEMORY:
   return JsonObject::invalid();
 }
 
+// Appends the pair without searching the key if the keys are unique.
+// Otherwise, the last value wins, as with JsonObject::set(), but the key is
+// found by the parser's own DuplicateKeyFinder, so that nothing but the pair
+// is allocated in the JsonBuffer.
+template <typename TReader, typename TWriter>
+template <typename TKeyFinder>
+inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::addMember(
+    JsonObject &object, TKeyFinder &keys, const char *key,
+    const JsonVariant &value) {
+#if !ARDUINOJSON_ASSUME_UNIQUE_KEYS
+  JsonPair *pair = keys.find(key);
+  if (pair) {
+    pair->value = value;
+    return true;
+  }
+#else
+  (void)keys;
+#endif
+  JsonObject::iterator it = object.add();
+  if (it == object.end()) return false;
+  it->key = key;
+  it->value = value;
+  return true;
+}
+
 template <typename TReader, typename TWriter>
 inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseObjectTo(
-    JsonVariant *destination) {
-  JsonObject &object = parseObject();
+    JsonVariant *destination, const JsonFilter &filter) {
+  JsonObject &object = parseObject(filter);
   if (!object.success()) return false;
 
   *destination = object;
@@ -141,43 +189,42 @@ ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseString() {
   typename RemoveReference<TWriter>::type::String str = _writer.startString();
 
   skipSpacesAndComments(_reader);
-  char c = _reader.current();
-
-  if (isQuote(c)) {  // quotes
-    _reader.move();
-    char stopChar = c;
-    for (;;) {
-      c = _reader.current();
-      if (c == '\0') break;
-      _reader.move();
-
-      if (c == stopChar) break;
-
-      if (c == '\\') {
-        // replace char
-        c = Encoding::unescapeChar(_reader.current());
-        if (c == '\0') break;
-        _reader.move();
-      }
-
-      str.append(c);
-    }
-  } else {  // no quotes
-    for (;;) {
-      if (!canBeInNonQuotedString(c)) break;
-      _reader.move();
-      str.append(c);
-      c = _reader.current();
-    }
-  }
+  readString(_reader, str);
 
   return str.c_str();
 }
 
+template <typename TReader, typename TWriter>
+inline const char *
+ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseKey() {
+  if (IsStringWriter<TWriter>::value || ARDUINOJSON_INTERNED_KEYS == 0)
+    return parseString();
+
+  typedef typename RemoveReference<TWriter>::type::String TString;
+  TString str = _writer.startString();
+  KeyScratch<TString> key(&str);
+
+  skipSpacesAndComments(_reader);
+  readString(_reader, key);
+  if (key.overflowed()) return str.c_str();
+
+  // a key that has already been stored doesn't need a copy
+  const char *copy = _keys.find(key);
+  if (copy) return copy;
+
+  str.append(key.data(), key.length());
+  copy = str.c_str();
+  if (copy) _keys.add(key, copy);
+  return copy;
+}
+
 template <typename TReader, typename TWriter>
 inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseStringTo(
     JsonVariant *destination) {
   bool hasQuotes = isQuote(_reader.current());
+#if ARDUINOJSON_EAGER_DECODING
+  if (!hasQuotes) return parseLiteralTo(destination);
+#endif
   const char *value = parseString();
   if (value == NULL) return false;
   if (hasQuotes) {
@@ -187,3 +234,46 @@ inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseStringTo(
   }
   return true;
 }
+
+template <typename TReader, typename TWriter>
+inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseLazyTo(
+    JsonVariant *destination) {
+  return Internals::parseLazyTo(_reader, _writer, _buffer, _nestingLimit,
+                                destination);
+}
+
+template <typename TReader, typename TWriter>
+inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::skipValue() {
+  return Internals::skipValue(_reader);
+}
+
+#if ARDUINOJSON_EAGER_DECODING
+template <typename TReader, typename TWriter>
+inline bool
+ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseLiteralTo(
+    JsonVariant *destination) {
+  // Read the token on the stack, so that nothing is written in the JsonBuffer
+  // if it's a number, a boolean or null.
+  // This is long enough for any float printed with 17 significant digits.
+  char buffer[32];
+  size_t n = 0;
+  while (n < sizeof(buffer) - 1 && canBeInNonQuotedString(_reader.current())) {
+    buffer[n++] = _reader.current();
+    _reader.move();
+  }
+  buffer[n] = '\0';
+
+  if (n > 0 && !canBeInNonQuotedString(_reader.current()) &&
+      decodeLiteral(buffer, destination))
+    return true;
+
+  // Not a literal (or too long), keep it as a string like parseString() does
+  typename RemoveReference<TWriter>::type::String str = _writer.startString();
+  str.append(buffer, n);
+  appendNonQuotedString(_reader, str);
+  const char *value = str.c_str();
+  if (value == NULL) return false;
+  *destination = RawJson(value);
+  return true;
+}
+#endif
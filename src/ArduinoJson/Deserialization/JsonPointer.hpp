@@ -0,0 +1,130 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint8_t, uint32_t
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Helpers for JSON Pointers (RFC 6901), like "/items/0/price".
+// The pointers are used as they are, there is no need to split them.
+class JsonPointer {
+ public:
+  // Returns the number of reference tokens, i.e. the depth of the value.
+  // Returns -1 if the pointer is invalid.
+  static int depth(const char *pointer) {
+    if (*pointer != '\0' && *pointer != '/') return -1;
+    int n = 0;
+    for (; *pointer; pointer++)
+      if (*pointer == '/') n++;
+    return n;
+  }
+
+  // Returns the reference token at the specified depth (0 is the first).
+  static const char *token(const char *pointer, int index) {
+    for (;;) {
+      pointer++;  // skip '/'
+      if (index-- == 0) return pointer;
+      while (*pointer != '/') pointer++;
+    }
+  }
+
+  // Reads the next character of a token, replacing "~0" and "~1".
+  // Returns false at the end of the token.
+  static bool nextChar(const char *&cursor, char &c) {
+    if (*cursor == '\0' || *cursor == '/') return false;
+    c = *cursor++;
+    if (c == '~') {
+      if (*cursor == '0')
+        c = '~';
+      else if (*cursor == '1')
+        c = '/';
+      else
+        return true;  // not an escape sequence
+      cursor++;
+    }
+    return true;
+  }
+
+  // Returns true if the token at the specified depth is the key
+  static bool matches(const char *pointer, int index, const char *key) {
+    const char *cursor = token(pointer, index);
+    char c;
+    while (nextChar(cursor, c))
+      if (c != *key++) return false;
+    return *key == '\0';
+  }
+
+  // Reads the token at the specified depth as an array index, i.e. "0" or
+  // digits without a leading zero.
+  // Returns false if the token is not an array index, or if it overflows.
+  static bool arrayIndex(const char *pointer, int index, size_t &result) {
+    const char *begin = token(pointer, index);
+    const char *cursor = begin;
+    if (*cursor == '0') {
+      result = 0;
+      cursor++;
+    } else {
+      const size_t maxValue = size_t(~size_t(0));
+      size_t value = 0;
+      for (; *cursor >= '0' && *cursor <= '9'; cursor++) {
+        size_t digit = size_t(*cursor - '0');
+        if (value > (maxValue - digit) / 10) return false;
+        value = value * 10 + digit;
+      }
+      if (cursor == begin) return false;  // empty token
+      result = value;
+    }
+    return *cursor == '\0' || *cursor == '/';
+  }
+};
+
+// A string that only compares itself to the tokens of a set of pointers.
+// Given to readString() instead of a real string, so that the keys are
+// matched while they are read, without storing them anywhere.
+class JsonPointerKeyMatcher {
+ public:
+  enum { MAX_POINTERS = 32 };
+
+  JsonPointerKeyMatcher(const char *const *pointers, uint32_t mask, int index)
+      : _mask(mask) {
+    for (int i = 0; i < MAX_POINTERS; i++)
+      if (mask & (uint32_t(1) << i))
+        _cursors[i] = JsonPointer::token(pointers[i], index);
+  }
+
+  void append(char c) {
+    for (int i = 0; i < MAX_POINTERS; i++) {
+      uint32_t bit = uint32_t(1) << i;
+      if (!(_mask & bit)) continue;
+      char expected;
+      if (!JsonPointer::nextChar(_cursors[i], expected) || expected != c)
+        _mask &= ~bit;
+    }
+  }
+
+  void append(const char *s, size_t n) {
+    while (n--) append(*s++);
+  }
+
+  // Returns the pointers whose token is the key
+  uint32_t mask() {
+    for (int i = 0; i < MAX_POINTERS; i++) {
+      uint32_t bit = uint32_t(1) << i;
+      char c;
+      if ((_mask & bit) && JsonPointer::nextChar(_cursors[i], c))
+        _mask &= ~bit;  // the token is longer than the key
+    }
+    return _mask;
+  }
+
+ private:
+  uint32_t _mask;
+  const char *_cursors[MAX_POINTERS];
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
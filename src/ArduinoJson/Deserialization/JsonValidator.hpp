@@ -0,0 +1,243 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for memcpy
+
+#include "../Configuration.hpp"
+#include "../JsonArray.hpp"
+#include "../JsonBuffer.hpp"
+#include "../JsonObject.hpp"
+#include "../StringTraits/StringTraits.hpp"
+#include "../TypeTraits/IsConst.hpp"
+#include "CharClasses.hpp"
+#include "Comments.hpp"
+#include "KeyInterner.hpp"
+#include "decodeLiteral.hpp"
+#include "readString.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A string that only counts its characters.
+// Given to readString() instead of a real string, so that nothing is written.
+class CharCounter {
+ public:
+  CharCounter() : _length(0) {}
+
+  void append(char) {
+    _length++;
+  }
+
+  void append(const char *, size_t n) {
+    _length += n;
+  }
+
+  size_t length() const {
+    return _length;
+  }
+
+ private:
+  size_t _length;
+};
+
+// Reads the input like JsonParser, but instead of allocating, it adds the
+// size of each allocation to a counter, including the padding.
+// This internal class is not indended to be used directly.
+// Instead, use validateJson()
+template <typename TReader>
+class JsonValidator {
+ public:
+  JsonValidator(TReader reader, bool copyStrings, uint8_t nestingLimit)
+      : _reader(reader),
+        _copyStrings(copyStrings),
+        _nestingLimit(nestingLimit),
+        _size(0) {}
+
+  bool validate() {
+    return validateAnything();
+  }
+
+  // Returns the number of bytes that JsonBuffer::parse() would use
+  size_t size() const {
+    return _size;
+  }
+
+ private:
+  bool eat(char charToSkip) {
+    skipSpacesAndComments(_reader);
+    if (_reader.current() != charToSkip) return false;
+    _reader.move();
+    return true;
+  }
+
+  // Same as JsonBuffer::alloc()
+  void alloc(size_t bytes) {
+    _size = JsonBuffer::round_size_up(_size) + bytes;
+  }
+
+  // Same as JsonBuffer::startString() and String::c_str(); these are not
+  // aligned
+  void allocString(size_t length) {
+    if (_copyStrings) _size += length + 1;
+  }
+
+  bool validateAnything() {
+    skipSpacesAndComments(_reader);
+
+    switch (_reader.current()) {
+      case '[':
+        return validateArray();
+
+      case '{':
+        return validateObject();
+
+      default:
+        return validateString();
+    }
+  }
+
+  bool validateArray() {
+    if (_nestingLimit == 0) return false;
+    _nestingLimit--;
+
+    alloc(sizeof(JsonArray));
+    _reader.move();  // skip '['
+    if (eat(']')) goto END_ARRAY;
+
+    for (;;) {
+      if (!validateAnything()) return false;
+      alloc(sizeof(JsonArray::node_type));
+
+      if (eat(']')) goto END_ARRAY;
+      if (!eat(',')) return false;
+    }
+
+  END_ARRAY:
+    _nestingLimit++;
+    return true;
+  }
+
+  bool validateObject() {
+    if (_nestingLimit == 0) return false;
+    _nestingLimit--;
+
+    alloc(sizeof(JsonObject));
+    _reader.move();  // skip '{'
+    if (eat('}')) goto END_OBJECT;
+
+    for (;;) {
+      skipSpacesAndComments(_reader);
+      KeyScratch<CharCounter> key(NULL);
+      readString(_reader, key);
+      if (!isInterned(key)) allocString(key.length());
+      if (!eat(':')) return false;
+
+      if (!validateAnything()) return false;
+      // Note: a duplicate key doesn't need a node (unless
+      // ARDUINOJSON_ASSUME_UNIQUE_KEYS), but the keys are not kept, so they
+      // are counted as distinct.
+      alloc(sizeof(JsonObject::node_type));
+
+      if (eat('}')) goto END_OBJECT;
+      if (!eat(',')) return false;
+    }
+
+  END_OBJECT:
+    _nestingLimit++;
+    return true;
+  }
+
+  // Same as JsonParser::parseKey(): the repeated keys are stored once.
+  // The validator keeps its own copy of the keys, since it stores nothing in
+  // a JsonBuffer.
+  bool isInterned(const KeyScratch<CharCounter> &key) {
+    if (!_copyStrings || ARDUINOJSON_INTERNED_KEYS == 0 || key.overflowed())
+      return false;
+    if (_keys.find(key)) return true;
+    char *copy = _keyCopies[_keys.indexOf(key.hash())];
+    memcpy(copy, key.data(), key.length());
+    copy[key.length()] = '\0';
+    _keys.add(key, copy);
+    return false;
+  }
+
+  bool validateString() {
+#if ARDUINOJSON_EAGER_DECODING
+    if (!isQuote(_reader.current())) return validateLiteral();
+#endif
+    CharCounter str;
+    readString(_reader, str);
+    allocString(str.length());
+    return true;
+  }
+
+#if ARDUINOJSON_EAGER_DECODING
+  // Same as JsonParser::parseLiteralTo(): the literals take no room
+  bool validateLiteral() {
+    char buffer[32];
+    size_t n = 0;
+    while (n < sizeof(buffer) - 1 &&
+           canBeInNonQuotedString(_reader.current())) {
+      buffer[n++] = _reader.current();
+      _reader.move();
+    }
+    buffer[n] = '\0';
+
+    JsonVariant value;
+    if (n > 0 && !canBeInNonQuotedString(_reader.current()) &&
+        decodeLiteral(buffer, &value))
+      return true;
+
+    CharCounter str;
+    appendNonQuotedString(_reader, str);
+    allocString(n + str.length());
+    return true;
+  }
+#endif
+
+  TReader _reader;
+  bool _copyStrings;
+  uint8_t _nestingLimit;
+  size_t _size;
+  KeyInterner<ARDUINOJSON_INTERNED_KEYS> _keys;
+  char _keyCopies[ARDUINOJSON_INTERNED_KEYS > 0 ? ARDUINOJSON_INTERNED_KEYS : 1]
+                 [KeyScratch<CharCounter>::SIZE + 1];
+};
+
+// The strings are copied in the JsonBuffer, except for char*, which is
+// modified in place
+template <typename TString, typename Enable = void>
+struct JsonValidatorBuilder {
+  typedef typename StringTraits<TString>::Reader TReader;
+
+  static JsonValidator<TReader> makeValidator(TString &json,
+                                              uint8_t nestingLimit) {
+    return JsonValidator<TReader>(TReader(json), true, nestingLimit);
+  }
+};
+
+template <typename TChar>
+struct JsonValidatorBuilder<TChar *,
+                            typename EnableIf<!IsConst<TChar>::value>::type> {
+  typedef typename StringTraits<TChar *>::Reader TReader;
+
+  static JsonValidator<TReader> makeValidator(TChar *json,
+                                              uint8_t nestingLimit) {
+    return JsonValidator<TReader>(TReader(json), false, nestingLimit);
+  }
+};
+
+template <typename TString>
+inline bool validateJson(TString &json, size_t *bufferSize,
+                         uint8_t nestingLimit) {
+  JsonValidator<typename JsonValidatorBuilder<TString>::TReader> validator =
+      JsonValidatorBuilder<TString>::makeValidator(json, nestingLimit);
+  bool ok = validator.validate();
+  if (ok && bufferSize) *bufferSize = validator.size();
+  return ok;
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -0,0 +1,116 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stddef.h>  // for size_t
+#include <string.h>  // for memcpy
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A string that keeps a short key on the stack while it's read, so that it
+// can be compared with the keys already stored.
+// The longer keys are not interned: once the scratch is full, the characters
+// are sent to the TString instead (if any).
+template <typename TString>
+class KeyScratch {
+ public:
+  enum { SIZE = 32 };
+
+  explicit KeyScratch(TString *overflow)
+      : _overflow(overflow), _length(0), _hash(0) {}
+
+  void append(char c) {
+    if (_length < SIZE) {
+      _data[_length] = c;
+      _hash = _hash * 31 + static_cast<unsigned char>(c);
+    } else if (_overflow) {
+      if (_length == SIZE) _overflow->append(_data, SIZE);
+      _overflow->append(c);
+    }
+    _length++;
+  }
+
+  void append(const char *s, size_t n) {
+    if (_length + n > SIZE) {
+      while (n--) append(*s++);
+      return;
+    }
+    memcpy(_data + _length, s, n);
+    _length += n;
+    while (n--) _hash = _hash * 31 + static_cast<unsigned char>(*s++);
+  }
+
+  // Returns true if the key is too long to be interned
+  bool overflowed() const {
+    return _length > SIZE;
+  }
+
+  const char *data() const {
+    return _data;
+  }
+
+  size_t length() const {
+    return _length;
+  }
+
+  size_t hash() const {
+    return _hash;
+  }
+
+  // Stops at the end of the key, which can be shorter than this one
+  bool equals(const char *key) const {
+    for (size_t i = 0; i < _length; i++) {
+      if (key[i] == '\0' || key[i] != _data[i]) return false;
+    }
+    return key[_length] == '\0';
+  }
+
+ private:
+  TString *_overflow;
+  size_t _length;
+  size_t _hash;
+  char _data[SIZE];
+};
+
+// A small hash table of the keys stored in the JsonBuffer.
+// A key replaces the previous one in its slot, so it holds the most recent
+// keys, which is enough for arrays of objects with the same keys.
+// The slots are cleared when the first key is added, because a parser is
+// created for each LazyJson, JSON Lines record and array part, and most of
+// them have few keys, if any.
+template <size_t CAPACITY>
+class KeyInterner {
+ public:
+  KeyInterner() : _empty(true) {}
+
+  static size_t indexOf(size_t hash) {
+    return hash % (CAPACITY > 0 ? CAPACITY : 1);
+  }
+
+  // Returns the stored copy of the key, or NULL if it's not there
+  template <typename TString>
+  const char *find(const KeyScratch<TString> &key) const {
+    if (_empty) return NULL;
+    const char *candidate = _keys[indexOf(key.hash())];
+    return candidate && key.equals(candidate) ? candidate : NULL;
+  }
+
+  template <typename TString>
+  void add(const KeyScratch<TString> &key, const char *copy) {
+    if (_empty) {
+      for (size_t i = 0; i < sizeof(_keys) / sizeof(_keys[0]); i++)
+        _keys[i] = NULL;
+      _empty = false;
+    }
+    _keys[indexOf(key.hash())] = copy;
+  }
+
+ private:
+  bool _empty;
+  const char *_keys[CAPACITY > 0 ? CAPACITY : 1];
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
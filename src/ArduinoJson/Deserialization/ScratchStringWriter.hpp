@@ -0,0 +1,104 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for memcpy
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A writer that holds one string at a time in a fixed-size array.
+// Used when the strings only need to live until the next one is read, i.e.
+// when they are passed to an event handler instead of being stored.
+// A string that doesn't fit is passed to the sink in pieces, and the array
+// only keeps its end. Without a sink, the string is lost.
+template <size_t CAPACITY>
+class ScratchStringWriter {
+ public:
+  class String {
+   public:
+    String(ScratchStringWriter* parent)
+        : _parent(parent), _sink(NULL), _passFunction(NULL) {
+      reset();
+    }
+
+    // TSink::operator()(const char*, size_t) receives the pieces, and
+    // returns false to drop the string.
+    template <typename TSink>
+    String(ScratchStringWriter* parent, TSink* sink)
+        : _parent(parent), _sink(sink), _passFunction(&passTo<TSink>) {
+      reset();
+    }
+
+    void append(char c) {
+      append(&c, 1);
+    }
+
+    void append(const char* s, size_t n) {
+      if (_parent->_dropped) return;
+      if (_parent->_size + n < CAPACITY) {
+        memcpy(_parent->_buffer + _parent->_size, s, n);
+        _parent->_size += n;
+        return;
+      }
+      if (!pass(_parent->_buffer, _parent->_size)) return;
+      _parent->_size = 0;
+      // a long span is passed as is, it comes straight from the input
+      if (n >= CAPACITY) {
+        pass(s, n);
+        return;
+      }
+      memcpy(_parent->_buffer, s, n);
+      _parent->_size = n;
+    }
+
+    // Returns NULL if the string was dropped
+    const char* c_str() const {
+      if (_parent->_dropped) return NULL;
+      _parent->_buffer[_parent->_size] = '\0';
+      return _parent->_buffer;
+    }
+
+   private:
+    template <typename TSink>
+    static bool passTo(void* sink, const char* s, size_t n) {
+      return (*static_cast<TSink*>(sink))(s, n);
+    }
+
+    void reset() {
+      // reuses the space of the previous string
+      _parent->_size = 0;
+      _parent->_dropped = false;
+    }
+
+    bool pass(const char* s, size_t n) {
+      if (n == 0) return true;
+      if (!_sink || !_passFunction(_sink, s, n)) _parent->_dropped = true;
+      return !_parent->_dropped;
+    }
+
+    ScratchStringWriter* _parent;
+    void* _sink;
+    bool (*_passFunction)(void*, const char*, size_t);
+  };
+
+  ScratchStringWriter() : _size(0), _dropped(false) {}
+
+  String startString() {
+    return String(this);
+  }
+
+  template <typename TSink>
+  String startString(TSink& sink) {
+    return String(this, &sink);
+  }
+
+ private:
+  char _buffer[CAPACITY];
+  size_t _size;
+  bool _dropped;
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -0,0 +1,53 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for strcspn
+
+#include "../StringTraits/StringTraits.hpp"
+#include "../TypeTraits/EnableIf.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Appends the characters of a quoted string that need no special treatment,
+// i.e. everything up to the closing quote, the next backslash or the end of
+// the input.
+// Only contiguous readers can do that in bulk, the others let the parser
+// handle the string one character at a time.
+template <typename TInput, typename TString>
+typename EnableIf<!IsContiguousReader<TInput>::value>::type
+appendUnescapedSpan(TInput&, TString&, char) {}
+
+template <typename TInput, typename TString>
+typename EnableIf<IsContiguousReader<TInput>::value>::type
+appendUnescapedSpan(TInput& input, TString& str, char stopChar) {
+  const char stopChars[] = {stopChar, '\\', '\0'};
+  const char* begin = input.ptr();
+  size_t n = strcspn(begin, stopChars);
+  if (n == 0) return;
+  str.append(begin, n);
+  input.jump(begin + n);
+}
+
+// Appends the characters that match the predicate, up to the first one that
+// doesn't.
+// Like above, this is a no-op for non-contiguous readers.
+template <typename TInput, typename TString, typename TPredicate>
+typename EnableIf<!IsContiguousReader<TInput>::value>::type appendSpanWhile(
+    TInput&, TString&, TPredicate) {}
+
+template <typename TInput, typename TString, typename TPredicate>
+typename EnableIf<IsContiguousReader<TInput>::value>::type appendSpanWhile(
+    TInput& input, TString& str, TPredicate predicate) {
+  const char* begin = input.ptr();
+  const char* end = begin;
+  while (predicate(*end)) end++;
+  if (end == begin) return;
+  str.append(begin, size_t(end - begin));
+  input.jump(end);
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
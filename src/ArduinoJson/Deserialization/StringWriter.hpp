@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <string.h>  // for memmove
+
 namespace ArduinoJson {
 namespace Internals {
 
@@ -18,6 +20,15 @@ class StringWriter {
       *(*_writePtr)++ = TChar(c);
     }
 
+    // Appends n characters that have already been read from the input.
+    // The source and the destination overlap when the string is modified in
+    // place, hence memmove().
+    void append(const char* s, size_t n) {
+      TChar* dst = *_writePtr;
+      if (reinterpret_cast<const char*>(dst) != s) memmove(dst, s, n);
+      *_writePtr = dst + n;
+    }
+
     const char* c_str() const {
       *(*_writePtr)++ = 0;
       return reinterpret_cast<const char*>(_startPtr);
@@ -37,5 +48,16 @@ class StringWriter {
  private:
   TChar* _ptr;
 };
+
+// Tells whether the writer stores the strings in the input
+template <typename TWriter>
+struct IsStringWriter {
+  static const bool value = false;
+};
+
+template <typename TChar>
+struct IsStringWriter<StringWriter<TChar> > {
+  static const bool value = true;
+};
 }
 }
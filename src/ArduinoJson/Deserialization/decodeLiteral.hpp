@@ -0,0 +1,46 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for strcmp
+
+#include "../JsonVariant.hpp"
+#include "../Polyfills/isFloat.hpp"
+#include "../Polyfills/isInteger.hpp"
+#include "../Polyfills/parseFloat.hpp"
+#include "../Polyfills/parseInteger.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Decodes a number, true, false or null.
+// Returns false if the string is none of these.
+// Used when ARDUINOJSON_EAGER_DECODING is set.
+inline bool decodeLiteral(const char *s, JsonVariant *destination) {
+  if (isInteger(s)) {
+    // isInteger() checked that the magnitude of a negative number fits in a
+    // JsonInteger; it's negated without overflowing, even for the minimum
+    bool negative = *s == '-';
+    JsonUInt magnitude = parseInteger<JsonUInt>(negative ? s + 1 : s);
+    if (negative && magnitude)
+      *destination = -static_cast<JsonInteger>(magnitude - 1) - 1;
+    else
+      *destination = magnitude;
+  } else if (isFloat(s)) {
+    *destination = parseFloat<JsonFloat>(s);
+  } else if (!strcmp(s, "true")) {
+    *destination = true;
+  } else if (!strcmp(s, "false")) {
+    *destination = false;
+  } else if (!strcmp(s, "null")) {
+    // points to a literal, so there is nothing to store
+    *destination = RawJson("null");
+  } else {
+    return false;
+  }
+  return true;
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -0,0 +1,39 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../Data/LazyJson.hpp"
+#include "../TypeTraits/RemoveReference.hpp"
+#include "skipValue.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Stores the text of the array or object in a LazyJson, so that it's parsed
+// when it's accessed.
+// The reader must be on the opening bracket.
+template <typename TReader, typename TWriter>
+bool parseLazyTo(TReader &reader, TWriter &writer, JsonBuffer *buffer,
+                 uint8_t nestingLimit, JsonVariant *destination) {
+  // like parseArray() and parseObject(), so that the limit is the same
+  if (nestingLimit == 0) return false;
+
+  typename RemoveReference<TWriter>::type::String str = writer.startString();
+  if (!appendValue(reader, str)) return false;
+  const char *json = str.c_str();
+  if (json == NULL) return false;
+
+  // The writer returns a const pointer, but the text is either the input,
+  // which is writable since the writer modifies it, or a copy in the
+  // JsonBuffer.
+  LazyJson *lazy =
+      new (buffer) LazyJson(buffer, const_cast<char *>(json), nestingLimit);
+  if (lazy == NULL) return false;
+
+  *destination = JsonVariant(lazy);
+  return true;
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -0,0 +1,57 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../Data/Encoding.hpp"
+#include "CharClasses.hpp"
+#include "StringSpans.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+template <typename TReader, typename TString>
+void appendNonQuotedString(TReader &reader, TString &str) {
+  appendSpanWhile(reader, str, canBeInNonQuotedString);
+  for (;;) {
+    char c = reader.current();
+    if (!canBeInNonQuotedString(c)) break;
+    reader.move();
+    str.append(c);
+  }
+}
+
+// Reads a string, with or without quotes, and unescapes the special chars.
+// The reader must be on the first character (i.e. the spaces are skipped).
+// Shared by JsonParser and JsonEventParser.
+template <typename TReader, typename TString>
+void readString(TReader &reader, TString &str) {
+  char c = reader.current();
+
+  if (isQuote(c)) {  // quotes
+    reader.move();
+    char stopChar = c;
+    for (;;) {
+      appendUnescapedSpan(reader, str, stopChar);
+      c = reader.current();
+      if (c == '\0') break;
+      reader.move();
+
+      if (c == stopChar) break;
+
+      if (c == '\\') {
+        // replace char
+        c = Encoding::unescapeChar(reader.current());
+        if (c == '\0') break;
+        reader.move();
+      }
+
+      str.append(c);
+    }
+  } else {  // no quotes
+    appendNonQuotedString(reader, str);
+  }
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
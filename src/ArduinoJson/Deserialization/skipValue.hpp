@@ -0,0 +1,205 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for strcspn
+
+#include "../StringTraits/StringTraits.hpp"
+#include "../TypeTraits/EnableIf.hpp"
+#include "CharClasses.hpp"
+#include "Comments.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Skips a string with quotes, the reader must be on the opening quote.
+// Returns false if the input ends before the closing quote.
+template <typename TReader>
+bool skipQuotedString(TReader &reader) {
+  char stopChar = reader.current();
+  reader.move();
+  for (;;) {
+    char c = reader.current();
+    if (c == '\0') return false;
+    reader.move();
+    if (c == stopChar) return true;
+    if (c == '\\') {
+      if (reader.current() == '\0') return false;
+      reader.move();
+    }
+  }
+}
+
+// Same as above, for a null-terminated string in RAM.
+// Returns a pointer after the closing quote, or NULL.
+inline const char *skipQuotedString(const char *s) {
+  const char stopChars[] = {*s, '\\', '\0'};
+  s++;
+  for (;;) {
+    s += strcspn(s, stopChars);
+    if (*s == '\0') return NULL;
+    if (*s == stopChars[0]) return s + 1;
+    // a backslash, skip the escaped char
+    if (s[1] == '\0') return NULL;
+    s += 2;
+  }
+}
+
+// Skips a value without storing anything, i.e. it never calls
+// JsonBuffer::alloc() nor startString().
+// Nested arrays and objects are not parsed: it only counts the brackets, so
+// the nesting limit doesn't apply, and the content is not fully validated.
+// Returns false if the input ends before the value.
+template <typename TReader>
+typename EnableIf<!IsContiguousReader<TReader>::value, bool>::type skipValue(
+    TReader &reader) {
+  skipSpacesAndComments(reader);
+  char c = reader.current();
+
+  if (isQuote(c)) return skipQuotedString(reader);
+
+  if (c != '[' && c != '{') {
+    while (canBeInNonQuotedString(reader.current())) reader.move();
+    return true;
+  }
+
+  int depth = 0;
+  for (;;) {
+    skipSpacesAndComments(reader);
+    switch (reader.current()) {
+      case '\0':
+        return false;
+
+      case '\'':
+      case '"':
+        if (!skipQuotedString(reader)) return false;
+        break;
+
+      case '[':
+      case '{':
+        depth++;
+        reader.move();
+        break;
+
+      case ']':
+      case '}':
+        reader.move();
+        if (--depth == 0) return true;
+        break;
+
+      default:
+        reader.move();
+        break;
+    }
+  }
+}
+
+// Same as above, for a null-terminated string in RAM.
+// The value begins after the leading spaces and comments, i.e. at
+// skipSpacesAndComments(s), and ends at the returned pointer, so the span can
+// be kept as a RawJson.
+// Returns NULL if the input ends before the value.
+inline const char *skipValue(const char *s) {
+  s = skipSpacesAndComments(s);
+
+  if (isQuote(*s)) return skipQuotedString(s);
+
+  if (*s != '[' && *s != '{') {
+    while (canBeInNonQuotedString(*s)) s++;
+    return s;
+  }
+
+  // Jumps from one special character to the next, so that the bulk of the
+  // content is scanned by strcspn()
+  int depth = 0;
+  for (;;) {
+    s += strcspn(s, "\"'[]{}/");
+    switch (*s) {
+      case '\0':
+        return NULL;
+
+      case '\'':
+      case '"':
+        s = skipQuotedString(s);
+        if (!s) return NULL;
+        break;
+
+      case '[':
+      case '{':
+        depth++;
+        s++;
+        break;
+
+      case ']':
+      case '}':
+        s++;
+        if (--depth == 0) return s;
+        break;
+
+      default: {  // '/'
+        const char *end = skipSpacesAndComments(s);
+        s = end != s ? end : s + 1;
+        break;
+      }
+    }
+  }
+}
+
+template <typename TReader>
+typename EnableIf<IsContiguousReader<TReader>::value, bool>::type skipValue(
+    TReader &reader) {
+  const char *end = skipValue(reader.ptr());
+  if (!end) return false;
+  reader.jump(end);
+  return true;
+}
+
+// A reader that appends the characters to a string as it moves.
+// Used to capture the text of a value with the generic skipValue().
+template <typename TReader, typename TString>
+class CopyingReader {
+ public:
+  CopyingReader(TReader &reader, TString &str) : _reader(&reader), _str(&str) {}
+
+  char current() const {
+    return _reader->current();
+  }
+
+  char next() const {
+    return _reader->next();
+  }
+
+  void move() {
+    _str->append(_reader->current());
+    _reader->move();
+  }
+
+ private:
+  TReader *_reader;
+  TString *_str;
+};
+
+// Skips a value and appends its text to the string.
+// The reader must be on the first character (i.e. the spaces are skipped).
+// Returns false if the input ends before the value.
+template <typename TReader, typename TString>
+typename EnableIf<!IsContiguousReader<TReader>::value, bool>::type appendValue(
+    TReader &reader, TString &str) {
+  CopyingReader<TReader, TString> copyingReader(reader, str);
+  return skipValue(copyingReader);
+}
+
+template <typename TReader, typename TString>
+typename EnableIf<IsContiguousReader<TReader>::value, bool>::type appendValue(
+    TReader &reader, TString &str) {
+  const char *begin = reader.ptr();
+  const char *end = skipValue(begin);
+  if (!end) return false;
+  str.append(begin, size_t(end - begin));
+  reader.jump(end);
+  return true;
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -0,0 +1,51 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for strlen
+
+#include "Comments.hpp"
+#include "skipValue.hpp"
+
+namespace ArduinoJson {
+
+// Splits a JSON array in parts of roughly the same size, at the element
+// boundaries, so that they can be parsed separately (for example in
+// parallel) with JsonBuffer::parseArrayPart().
+//
+// The elements are found with a quick scan of the input: the strings and the
+// brackets are skipped, but the values are not parsed.
+//
+// bounds receives partCount + 1 pointers: the part i is from bounds[i] to
+// bounds[i + 1]. Each part begins with the '[' or the ',' that precedes its
+// first element, and the last bound is the closing ']'. A part is empty if
+// there are fewer elements than parts.
+//
+// Returns false if the input is not an array.
+inline bool splitJsonArray(const char *json, const char **bounds,
+                           size_t partCount) {
+  const char *p = Internals::skipSpacesAndComments(json);
+  if (*p != '[') return false;
+
+  const char *begin = p;
+  size_t size = strlen(begin);
+  size_t part = 1;
+  bounds[0] = begin;
+
+  for (;;) {
+    // p is on the '[' or the ',' before the element
+    const char *end = Internals::skipValue(p + 1);
+    if (!end) return false;
+    p = Internals::skipSpacesAndComments(end);
+    if (*p == ']') break;
+    if (*p != ',') return false;
+    if (part < partCount && size_t(p - begin) >= size / partCount * part)
+      bounds[part++] = p;
+  }
+
+  while (part <= partCount) bounds[part++] = p;
+  return true;
+}
+}  // namespace ArduinoJson
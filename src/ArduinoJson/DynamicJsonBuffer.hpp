@@ -79,24 +79,49 @@ class DynamicJsonBufferBase
     _head = 0;
   }
 
+  // Same as clear(), but keeps the largest block, so that the next
+  // allocations don't call the allocator, as long as they fit in it.
+  // USE WITH CAUTION: this invalidates all previously allocated data
+  void recycle() {
+    Block* largest = _head;
+    for (Block* b = _head; b != NULL; b = b->next) {
+      if (b->capacity > largest->capacity) largest = b;
+    }
+    Block* currentBlock = _head;
+    while (currentBlock != NULL) {
+      Block* nextBlock = currentBlock->next;
+      if (currentBlock != largest) _allocator.deallocate(currentBlock);
+      currentBlock = nextBlock;
+    }
+    _head = largest;
+    if (_head) {
+      _head->next = NULL;
+      _head->size = 0;
+    }
+  }
+
   class String {
    public:
     String(DynamicJsonBufferBase* parent)
         : _parent(parent), _start(NULL), _length(0) {}
 
     void append(char c) {
-      if (_parent->canAllocInHead(1)) {
-        char* end = static_cast<char*>(_parent->allocInHead(1));
-        *end = c;
+      append(&c, 1);
+    }
+
+    void append(const char* s, size_t n) {
+      if (_parent->canAllocInHead(n)) {
+        char* end = static_cast<char*>(_parent->allocInHead(n));
+        memcpy(end, s, n);
         if (_length == 0) _start = end;
       } else {
         char* newStart =
-            static_cast<char*>(_parent->allocInNewBlock(_length + 1));
+            static_cast<char*>(_parent->allocInNewBlock(_length + n));
         if (_start && newStart) memcpy(newStart, _start, _length);
-        if (newStart) newStart[_length] = c;
+        if (newStart) memcpy(newStart + _length, s, n);
         _start = newStart;
       }
-      _length++;
+      _length += n;
     }
 
     const char* c_str() {
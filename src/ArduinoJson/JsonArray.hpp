@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "Configuration.hpp"
+#include "Data/JsonArrayIndex.hpp"
 #include "Data/JsonBufferAllocated.hpp"
 #include "Data/List.hpp"
 #include "Data/ReferenceType.hpp"
@@ -18,6 +20,11 @@
 
 // Returns the size (in bytes) of an array with n elements.
 // Can be very handy to determine the size of a StaticJsonBuffer.
+// sizeof(JsonArray) includes the head of the list: the pointers to the first
+// and last nodes, and the number of nodes, plus the last visited node and its
+// position (four words more than a bare list), plus the pointer to the index
+// when ARDUINOJSON_ARRAY_INDEX_THRESHOLD is set. The index itself is not
+// included.
 #define JSON_ARRAY_SIZE(NUMBER_OF_ELEMENTS) \
   (sizeof(JsonArray) + (NUMBER_OF_ELEMENTS) * sizeof(JsonArray::node_type))
 
@@ -28,6 +35,7 @@ class JsonObject;
 class JsonBuffer;
 namespace Internals {
 class JsonArraySubscript;
+class JsonCompactor;
 }
 
 // An array of JsonVariant.
@@ -46,7 +54,15 @@ class JsonArray : public Internals::JsonPrintable<JsonArray>,
   // You should not call this constructor directly.
   // Instead, use JsonBuffer::createArray() or JsonBuffer::parseArray().
   explicit JsonArray(JsonBuffer *buffer) throw()
-      : Internals::List<JsonVariant>(buffer) {}
+      : Internals::List<JsonVariant>(buffer),
+        _lastVisitedNode(NULL),
+        _lastVisitedIndex(0)
+#if ARDUINOJSON_ARRAY_INDEX_THRESHOLD > 0
+        ,
+        _index(NULL)
+#endif
+  {
+  }
 
   // Gets the value at the specified index
   const Internals::JsonArraySubscript operator[](size_t index) const;
@@ -107,14 +123,14 @@ class JsonArray : public Internals::JsonPrintable<JsonArray>,
   // Gets the value at the specified index.
   template <typename T>
   typename Internals::JsonVariantAs<T>::type get(size_t index) const {
-    const_iterator it = begin() += index;
+    const_iterator it = nodeAt(index);
     return it != end() ? it->as<T>() : Internals::JsonVariantDefault<T>::get();
   }
 
   // Check the type of the value at specified index.
   template <typename T>
   bool is(size_t index) const {
-    const_iterator it = begin() += index;
+    const_iterator it = nodeAt(index);
     return it != end() ? it->is<T>() : false;
   }
 
@@ -128,9 +144,27 @@ class JsonArray : public Internals::JsonPrintable<JsonArray>,
 
   // Removes element at specified index.
   void remove(size_t index) {
-    remove(begin() += index);
+    remove(nodeAt(index));
+  }
+  void remove(iterator it) {
+    Internals::List<JsonVariant>::remove(it);
+    _lastVisitedNode = NULL;
+#if ARDUINOJSON_ARRAY_INDEX_THRESHOLD > 0
+    if (_index) _index->clear();
+#endif
+  }
+
+  // Moves the elements of another array to the end of this one.
+  // The position cache and the index of this array still apply, the other
+  // one loses its nodes.
+  void splice(JsonArray &other) {
+    Internals::List<JsonVariant>::splice(other);
+    if (other.size()) return;
+    other._lastVisitedNode = NULL;
+#if ARDUINOJSON_ARRAY_INDEX_THRESHOLD > 0
+    if (other._index) other._index->clear();
+#endif
   }
-  using Internals::List<JsonVariant>::remove;
 
   // Returns a reference an invalid JsonArray.
   // This object is meant to replace a NULL pointer.
@@ -201,9 +235,56 @@ class JsonArray : public Internals::JsonPrintable<JsonArray>,
 #endif
 
  private:
+  friend class Internals::JsonCompactor;
+
+  // Returns the node at the specified position, or end()
+  // Without an index, the walk starts from the last visited node when it's
+  // not past the requested one, so that a loop over the indexes takes linear
+  // time instead of quadratic.
+  iterator nodeAt(size_t index) {
+#if ARDUINOJSON_ARRAY_INDEX_THRESHOLD > 0
+    if (this->index()) return iterator(_index->at(index));
+#endif
+    node_type *node = firstNode();
+    size_t i = 0;
+    if (_lastVisitedNode && _lastVisitedIndex <= index) {
+      node = _lastVisitedNode;
+      i = _lastVisitedIndex;
+    }
+    for (; node && i < index; i++) node = node->next;
+    if (node) {
+      _lastVisitedNode = node;
+      _lastVisitedIndex = index;
+    }
+    return iterator(node);
+  }
+  const_iterator nodeAt(size_t index) const {
+    return const_cast<JsonArray *>(this)->nodeAt(index);
+  }
+
+#if ARDUINOJSON_ARRAY_INDEX_THRESHOLD > 0
+  // Brings the index up to date with the list, or creates it once the array
+  // is big enough. Returns NULL if the array has no index.
+  Internals::JsonArrayIndex *index() {
+    if (_index && !_index->update(firstNode())) _index = NULL;
+    if (!_index && size() > ARDUINOJSON_ARRAY_INDEX_THRESHOLD) {
+      _index = Internals::JsonArrayIndex::create(_buffer, size());
+      if (_index && !_index->update(firstNode())) _index = NULL;
+    }
+    return _index;
+  }
+#endif
+
+  // The node of the last access by position, forgotten when a node is removed
+  node_type *_lastVisitedNode;
+  size_t _lastVisitedIndex;
+#if ARDUINOJSON_ARRAY_INDEX_THRESHOLD > 0
+  Internals::JsonArrayIndex *_index;
+#endif
+
   template <typename TValueRef>
   bool set_impl(size_t index, TValueRef value) {
-    iterator it = begin() += index;
+    iterator it = nodeAt(index);
     if (it == end()) return false;
     return Internals::ValueSaver<TValueRef>::save(_buffer, *it, value);
   }
@@ -59,13 +59,8 @@ class JsonBuffer : Internals::NonCopyable {
   // Return a pointer to the allocated memory or NULL if allocation fails.
   virtual void *alloc(size_t size) = 0;
 
- protected:
-  // CAUTION: NO VIRTUAL DESTRUCTOR!
-  // If we add a virtual constructor the Arduino compiler will add malloc()
-  // and free() to the binary, adding 706 useless bytes.
-  ~JsonBuffer() {}
-
   // Preserve aligment if necessary
+  // Public so that validateJson() can predict the padding.
   static FORCE_INLINE size_t round_size_up(size_t bytes) {
 #if ARDUINOJSON_ENABLE_ALIGNMENT
     const size_t x = sizeof(void *) - 1;
@@ -74,5 +69,11 @@ class JsonBuffer : Internals::NonCopyable {
     return bytes;
 #endif
   }
+
+ protected:
+  // CAUTION: NO VIRTUAL DESTRUCTOR!
+  // If we add a virtual constructor the Arduino compiler will add malloc()
+  // and free() to the binary, adding 706 useless bytes.
+  ~JsonBuffer() {}
 };
 }
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "Data/JsonCompactor.hpp"
+#include "Deserialization/JsonExtractor.hpp"
 #include "Deserialization/JsonParser.hpp"
 
 namespace ArduinoJson {
@@ -49,6 +51,56 @@ class JsonBufferBase : public JsonBuffer {
     return Internals::makeParser(that(), json, nestingLimit).parseArray();
   }
 
+  // Same as above, but only keeps the parts selected by the filter.
+  // The other values are skipped without using the JsonBuffer.
+  //
+  // JsonArray& parseArray(TString, JsonFilter);
+  // TString = const std::string&, const String&
+  template <typename TString>
+  typename Internals::EnableIf<!Internals::IsArray<TString>::value,
+                               JsonArray &>::type
+  parseArray(const TString &json, const JsonFilter &filter,
+             uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseArray(filter);
+  }
+  //
+  // JsonArray& parseArray(TString, JsonFilter);
+  // TString = const char*, const char[N], const FlashStringHelper*
+  template <typename TString>
+  JsonArray &parseArray(
+      TString *json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseArray(filter);
+  }
+  //
+  // JsonArray& parseArray(TString, JsonFilter);
+  // TString = std::istream&, Stream&
+  template <typename TString>
+  JsonArray &parseArray(
+      TString &json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseArray(filter);
+  }
+
+  // Parses a part of an array, as returned by splitJsonArray().
+  // The part is copied in the JsonBuffer (and only there), then parsed in
+  // place. The arrays of the parts can be put back together with splice().
+  JsonArray &parseArrayPart(
+      const char *begin, const char *end,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    if (begin == end) return that()->createArray();
+    // the ',' before the first element becomes the '['
+    typename TDerived::String str = that()->startString();
+    str.append('[');
+    str.append(begin + 1, size_t(end - begin - 1));
+    str.append(']');
+    // fails if the copy failed, since NULL is an empty input
+    return parseArray(const_cast<char *>(str.c_str()), nestingLimit);
+  }
+
   // Allocates and populate a JsonObject from a JSON string.
   //
   // The First argument is a pointer to the JSON string, the memory must be
@@ -86,6 +138,107 @@ class JsonBufferBase : public JsonBuffer {
     return Internals::makeParser(that(), json, nestingLimit).parseObject();
   }
 
+  // Same as above, but only keeps the parts selected by the filter.
+  // The other values are skipped without using the JsonBuffer.
+  //
+  // JsonObject& parseObject(TString, JsonFilter);
+  // TString = const std::string&, const String&
+  template <typename TString>
+  typename Internals::EnableIf<!Internals::IsArray<TString>::value,
+                               JsonObject &>::type
+  parseObject(const TString &json, const JsonFilter &filter,
+              uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseObject(filter);
+  }
+  //
+  // JsonObject& parseObject(TString, JsonFilter);
+  // TString = const char*, const char[N], const FlashStringHelper*
+  template <typename TString>
+  JsonObject &parseObject(
+      TString *json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseObject(filter);
+  }
+  //
+  // JsonObject& parseObject(TString, JsonFilter);
+  // TString = std::istream&, Stream&
+  template <typename TString>
+  JsonObject &parseObject(
+      TString &json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseObject(filter);
+  }
+
+  // Allocates and populate a JsonArray or a JsonObject from a JSON string, but
+  // only the top level is parsed.
+  // The nested arrays and objects are kept as text, and are parsed the first
+  // time they are accessed (as<JsonArray>(), as<JsonObject>(), subscript...).
+  // Until then, they are serialized as they were in the input.
+  //
+  // With a char*, the text is not copied, but the input must stay in memory
+  // as long as the JsonArray or JsonObject.
+  //
+  // JsonArray& parseArrayLazily(TString);
+  // TString = const std::string&, const String&
+  template <typename TString>
+  typename Internals::EnableIf<!Internals::IsArray<TString>::value,
+                               JsonArray &>::type
+  parseArrayLazily(const TString &json,
+                   uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseArrayLazily();
+  }
+  //
+  // JsonArray& parseArrayLazily(TString);
+  // TString = char*, const char*, const char[N], const FlashStringHelper*
+  template <typename TString>
+  JsonArray &parseArrayLazily(
+      TString *json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseArrayLazily();
+  }
+  //
+  // JsonArray& parseArrayLazily(TString);
+  // TString = std::istream&, Stream&
+  template <typename TString>
+  JsonArray &parseArrayLazily(
+      TString &json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseArrayLazily();
+  }
+  //
+  // JsonObject& parseObjectLazily(TString);
+  // TString = const std::string&, const String&
+  template <typename TString>
+  typename Internals::EnableIf<!Internals::IsArray<TString>::value,
+                               JsonObject &>::type
+  parseObjectLazily(const TString &json,
+                    uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseObjectLazily();
+  }
+  //
+  // JsonObject& parseObjectLazily(TString);
+  // TString = char*, const char*, const char[N], const FlashStringHelper*
+  template <typename TString>
+  JsonObject &parseObjectLazily(
+      TString *json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseObjectLazily();
+  }
+  //
+  // JsonObject& parseObjectLazily(TString);
+  // TString = std::istream&, Stream&
+  template <typename TString>
+  JsonObject &parseObjectLazily(
+      TString &json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseObjectLazily();
+  }
+
   // Generalized version of parseArray() and parseObject(), also works for
   // integral types.
   //
@@ -115,6 +268,104 @@ class JsonBufferBase : public JsonBuffer {
     return Internals::makeParser(that(), json, nestingLimit).parseVariant();
   }
 
+  // Same as above, but only keeps the parts selected by the filter.
+  // The other values are skipped without using the JsonBuffer.
+  //
+  // JsonVariant parse(TString, JsonFilter);
+  // TString = const std::string&, const String&
+  template <typename TString>
+  typename Internals::EnableIf<!Internals::IsArray<TString>::value,
+                               JsonVariant>::type
+  parse(const TString &json, const JsonFilter &filter,
+        uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseVariant(filter);
+  }
+  //
+  // JsonVariant parse(TString, JsonFilter);
+  // TString = const char*, const char[N], const FlashStringHelper*
+  template <typename TString>
+  JsonVariant parse(
+      TString *json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseVariant(filter);
+  }
+  //
+  // JsonVariant parse(TString, JsonFilter);
+  // TString = std::istream&, Stream&
+  template <typename TString>
+  JsonVariant parse(
+      TString &json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeParser(that(), json, nestingLimit)
+        .parseVariant(filter);
+  }
+
+  // Finds the values designated by JSON Pointers (RFC 6901), like
+  // "/items/0/price", in a single pass over the input.
+  // Only these values are stored in the JsonBuffer, and the parsing stops as
+  // soon as they're all found. The arrays and objects are parsed lazily (see
+  // parseArrayLazily()).
+  //
+  // The values are written in the same order as the pointers, the ones that
+  // are not found are undefined (i.e. success() returns false).
+  // At most 32 pointers are supported, the extra ones are ignored.
+  //
+  // Returns false if the input is invalid.
+  //
+  // bool extract(TString, const char* pointers[], JsonVariant values[], n);
+  // TString = const std::string&, const String&
+  template <typename TString>
+  typename Internals::EnableIf<!Internals::IsArray<TString>::value, bool>::type
+  extract(const TString &json, const char *const *pointers,
+          JsonVariant *values, size_t count,
+          uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeExtractor(that(), json, nestingLimit)
+        .extract(pointers, values, count);
+  }
+  //
+  // bool extract(TString, const char* pointers[], JsonVariant values[], n);
+  // TString = char*, const char*, const char[N], const FlashStringHelper*
+  template <typename TString>
+  bool extract(TString *json, const char *const *pointers, JsonVariant *values,
+               size_t count,
+               uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeExtractor(that(), json, nestingLimit)
+        .extract(pointers, values, count);
+  }
+  //
+  // bool extract(TString, const char* pointers[], JsonVariant values[], n);
+  // TString = std::istream&, Stream&
+  template <typename TString>
+  bool extract(TString &json, const char *const *pointers, JsonVariant *values,
+               size_t count,
+               uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+    return Internals::makeExtractor(that(), json, nestingLimit)
+        .extract(pointers, values, count);
+  }
+
+  // Copies a document in this JsonBuffer, so that the elements of each array
+  // and object are contiguous, followed by their strings and their nested
+  // containers. The copy is faster to walk than a parsed document, because
+  // it's more compact; it's an ordinary document otherwise: the keys are not
+  // sorted, and the lookups use a hash table only when
+  // ARDUINOJSON_OBJECT_INDEX_THRESHOLD or ARDUINOJSON_ARRAY_INDEX_THRESHOLD is
+  // set (then, the big containers get their index right away).
+  // The copy doesn't depend on the source, which can be cleared.
+  //
+  // Returns an invalid reference if the JsonBuffer is too small.
+  //
+  // JsonArray& copyCompactly(const JsonArray&);
+  JsonArray &copyCompactly(const JsonArray &source) {
+    return Internals::JsonCompactor(that()).copy(source);
+  }
+  //
+  // JsonObject& copyCompactly(const JsonObject&);
+  JsonObject &copyCompactly(const JsonObject &source) {
+    return Internals::JsonCompactor(that()).copy(source);
+  }
+
  protected:
   ~JsonBufferBase() {}
 
@@ -0,0 +1,94 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "Deserialization/JsonEventParser.hpp"
+#include "TypeTraits/EnableIf.hpp"
+#include "TypeTraits/IsArray.hpp"
+
+namespace ArduinoJson {
+
+// A handler for parseJsonEvents() that ignores everything.
+// Derive from it and hide the functions you need; the calls are resolved at
+// compile time, so there is no virtual function.
+// Each function returns false to stop the parsing.
+//
+// The strings passed to onKey(), onString() and onNumber() are only valid
+// during the call. Numbers are passed as text, so that the handler doesn't pay
+// for the conversion of the values it ignores.
+//
+// Unless the input is a char*, the parser holds a key or a string in an
+// array of ARDUINOJSON_EVENT_STRING_SIZE bytes. When it doesn't fit, the
+// beginning goes to onKeyPart() or onStringPart(), in one or more pieces, and
+// the end to onKey() or onString(). By default, the pieces are skipped, so
+// the handler only sees the end of a long string.
+struct JsonEventHandler {
+  bool onStartObject() {
+    return true;
+  }
+  bool onEndObject() {
+    return true;
+  }
+  bool onStartArray() {
+    return true;
+  }
+  bool onEndArray() {
+    return true;
+  }
+  bool onKey(const char *, size_t) {
+    return true;
+  }
+  bool onString(const char *, size_t) {
+    return true;
+  }
+  bool onKeyPart(const char *, size_t) {
+    return true;
+  }
+  bool onStringPart(const char *, size_t) {
+    return true;
+  }
+  bool onNumber(const char *, size_t) {
+    return true;
+  }
+  bool onBool(bool) {
+    return true;
+  }
+  bool onNull() {
+    return true;
+  }
+};
+
+// Parses a JSON input and calls the handler for each token, without storing
+// anything in a JsonBuffer.
+// Returns false if the input is invalid, or if the handler stopped the parsing.
+// The strings longer than ARDUINOJSON_EVENT_STRING_SIZE - 1 are passed in
+// pieces (see JsonEventHandler), except for char*, which is modified in place.
+//
+// bool parseJsonEvents(TString, THandler&);
+// TString = const std::string&, const String&
+template <typename TString, typename THandler>
+typename Internals::EnableIf<!Internals::IsArray<TString>::value, bool>::type
+parseJsonEvents(const TString &json, THandler &handler,
+                uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+  return Internals::parseJsonEvents(json, handler, nestingLimit);
+}
+//
+// bool parseJsonEvents(TString, THandler&);
+// TString = char*, const char*, const char[N], const FlashStringHelper*
+template <typename TString, typename THandler>
+bool parseJsonEvents(TString *json, THandler &handler,
+                     uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+  return Internals::parseJsonEvents(json, handler, nestingLimit);
+}
+//
+// bool parseJsonEvents(TString, THandler&);
+// TString = std::istream&, Stream&
+template <typename TString, typename THandler>
+bool parseJsonEvents(TString &json, THandler &handler,
+                     uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+  return Internals::parseJsonEvents(json, handler, nestingLimit);
+}
+}  // namespace ArduinoJson
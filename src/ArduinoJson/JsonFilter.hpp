@@ -0,0 +1,47 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "JsonVariant.hpp"
+
+namespace ArduinoJson {
+
+// Selects the parts of a document to keep when parsing.
+// The filter is a JsonVariant with the same shape as the document:
+//   true        keeps the value
+//   false       skips the value (so does a missing key)
+//   {...}       keeps the listed members of an object; "*" matches any key
+//   [filter]    applies the filter to every element of an array
+// The skipped values are not stored in the JsonBuffer.
+class JsonFilter {
+ public:
+  explicit JsonFilter(JsonVariant variant)
+      : _variant(variant),
+        _allowAll(variant.is<bool>() && variant.as<bool>()) {}
+
+  // Returns a filter that keeps everything
+  static JsonFilter all() {
+    return JsonFilter(true);
+  }
+
+  // Returns true if the whole value must be kept
+  bool allowAll() const {
+    return _allowAll;
+  }
+
+  // Returns true if at least a part of the value must be kept
+  bool allow() const;
+
+  // Returns the filter for the member of an object
+  JsonFilter operator[](const char *key) const;
+
+  // Returns the filter for the elements of an array
+  JsonFilter elements() const;
+
+ private:
+  JsonVariant _variant;
+  bool _allowAll;  // cached, because it's checked for every value
+};
+}  // namespace ArduinoJson
@@ -0,0 +1,29 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "JsonArray.hpp"
+#include "JsonFilter.hpp"
+#include "JsonObject.hpp"
+
+namespace ArduinoJson {
+
+inline bool JsonFilter::allow() const {
+  return allowAll() || _variant.is<JsonObject>() || _variant.is<JsonArray>();
+}
+
+inline JsonFilter JsonFilter::operator[](const char *key) const {
+  if (allowAll()) return *this;
+  JsonObject &object = _variant.as<JsonObject>();
+  JsonVariant member = object.get<JsonVariant>(key);
+  if (!member.success()) member = object.get<JsonVariant>("*");
+  return JsonFilter(member);
+}
+
+inline JsonFilter JsonFilter::elements() const {
+  if (allowAll()) return *this;
+  return JsonFilter(_variant.as<JsonArray>().get<JsonVariant>(0));
+}
+}  // namespace ArduinoJson
@@ -0,0 +1,260 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for memchr, strlen
+
+#include "DynamicJsonBuffer.hpp"
+#include "JsonVariant.hpp"
+#include "StringTraits/StringTraits.hpp"
+#include "TypeTraits/RemoveReference.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Empties the JsonBuffer before the next document.
+// A DynamicJsonBuffer keeps its largest block, so that the allocator is only
+// called when a document is bigger than all the previous ones.
+template <typename TJsonBuffer>
+inline void recycleJsonBuffer(TJsonBuffer &buffer) {
+  buffer.clear();
+}
+
+template <typename TAllocator>
+inline void recycleJsonBuffer(DynamicJsonBufferBase<TAllocator> &buffer) {
+  buffer.recycle();
+}
+
+// The part of JsonLinesReader that doesn't depend on the input.
+template <typename TJsonBuffer>
+class JsonLinesReaderBase {
+ public:
+  // Returns the current document, or an undefined variant if the record is
+  // not valid JSON (or doesn't fit in the JsonBuffer).
+  JsonVariant document() const {
+    return _document;
+  }
+
+  // Tells whether the current record has been parsed successfully
+  bool success() const {
+    return _document.success();
+  }
+
+  // Returns the number of records read so far, including the current one.
+  // Empty lines are not records.
+  size_t count() const {
+    return _count;
+  }
+
+ protected:
+  // Record Separator, the first character of each record in a JSON text
+  // sequence (RFC 7464)
+  enum { RS = 0x1E };
+
+  JsonLinesReaderBase(TJsonBuffer &buffer, uint8_t nestingLimit)
+      : _buffer(&buffer),
+        _nestingLimit(nestingLimit),
+        _count(0),
+        _separator(0) {}
+
+  static bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  }
+
+  // Picks the separator from the first character of the input: RS for a JSON
+  // text sequence, where a record may span several lines, or a newline for
+  // JSON Lines / NDJSON.
+  void detectSeparator(char firstChar) {
+    if (!_separator) _separator = firstChar == RS ? char(RS) : '\n';
+  }
+
+  void beginRecord() {
+    recycleJsonBuffer(*_buffer);
+    _document = JsonVariant();
+  }
+
+  // The record must be null-terminated and writable, it's parsed in place
+  void endRecord(char *json) {
+    _count++;
+    if (json) _document = _buffer->parse(json, _nestingLimit);
+  }
+
+  // Same, for a record that has been copied in the JsonBuffer.
+  // The copy is writable even though the String returns a const pointer.
+  void endRecord(const char *copy) {
+    endRecord(const_cast<char *>(copy));
+  }
+
+  TJsonBuffer *_buffer;
+  uint8_t _nestingLimit;
+  size_t _count;
+  char _separator;  // 0 until the first record
+  JsonVariant _document;
+};
+}  // namespace Internals
+
+// Iterates over the documents of a JSON Lines (aka NDJSON) input, or of a JSON
+// text sequence (RFC 7464).
+//
+// All the documents share the same JsonBuffer: it's emptied at each step, so
+// the previous document becomes invalid when next() is called. A
+// DynamicJsonBuffer keeps its largest block between the documents.
+//
+// A record that is not valid JSON doesn't stop the iteration, document()
+// returns an undefined variant, and next() moves to the following record.
+//
+// With a stream, each record is copied in the JsonBuffer (and only there) and
+// parsed in place.
+//
+// JsonLinesReader<TJsonBuffer, TInput>
+// TInput = std::istream&, Stream&
+template <typename TJsonBuffer, typename TInput>
+class JsonLinesReader : public Internals::JsonLinesReaderBase<TJsonBuffer> {
+  typedef Internals::JsonLinesReaderBase<TJsonBuffer> base;
+  typedef typename Internals::StringTraits<
+      typename Internals::RemoveReference<TInput>::type>::Reader TReader;
+
+ public:
+  JsonLinesReader(TJsonBuffer &buffer, TInput input,
+                  uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT)
+      : base(buffer, nestingLimit), _reader(input) {}
+
+  // Moves to the next record.
+  // Returns false when the end of the input is reached.
+  bool next() {
+    base::beginRecord();
+
+    // skip empty lines
+    char c = _reader.current();
+    while (base::isSpace(c) || c == base::RS) {
+      base::detectSeparator(c);
+      _reader.move();
+      c = _reader.current();
+    }
+    if (c == '\0') return false;
+    base::detectSeparator(c);
+
+    typename TJsonBuffer::String str = base::_buffer->startString();
+    while (c != '\0' && c != base::_separator) {
+      str.append(c);
+      _reader.move();
+      c = _reader.current();
+    }
+    base::endRecord(str.c_str());
+    return true;
+  }
+
+ private:
+  TReader _reader;
+};
+
+// Same as above, for a range of characters in RAM, like a memory-mapped file.
+// The range doesn't need to be null-terminated.
+//
+// If the characters are writable, the records are parsed in place, i.e. the
+// separators are replaced by null-terminators, and the strings are stored in
+// the input; only the last record is copied if it doesn't end with a
+// separator.
+//
+// JsonLinesReader<TJsonBuffer, TChar*>
+// TChar* = char*, const char*
+template <typename TJsonBuffer, typename TChar>
+class JsonLinesReader<TJsonBuffer, TChar *>
+    : public Internals::JsonLinesReaderBase<TJsonBuffer> {
+  typedef Internals::JsonLinesReaderBase<TJsonBuffer> base;
+
+ public:
+  JsonLinesReader(TJsonBuffer &buffer, TChar *begin, TChar *end,
+                  uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT)
+      : base(buffer, nestingLimit), _ptr(begin), _end(end) {}
+
+  // The input is null-terminated
+  JsonLinesReader(TJsonBuffer &buffer, TChar *json,
+                  uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT)
+      : base(buffer, nestingLimit),
+        _ptr(json),
+        _end(json + strlen(reinterpret_cast<const char *>(json))) {}
+
+  // Moves to the next record.
+  // Returns false when the end of the input is reached.
+  bool next() {
+    base::beginRecord();
+
+    // skip empty lines
+    while (_ptr < _end && (base::isSpace(char(*_ptr)) || *_ptr == base::RS)) {
+      base::detectSeparator(char(*_ptr));
+      _ptr++;
+    }
+    if (_ptr == _end) return false;
+    base::detectSeparator(char(*_ptr));
+
+    TChar *begin = _ptr;
+    TChar *end = static_cast<TChar *>(
+        memchr(begin, base::_separator, size_t(_end - begin)));
+    if (end) {
+      _ptr = end + 1;
+      parse(begin, end);
+    } else {
+      _ptr = _end;
+      copyAndParse(begin, _end);
+    }
+    return true;
+  }
+
+ private:
+  // Writable input: the separator becomes the null-terminator
+  void parse(char *begin, char *end) {
+    *end = '\0';
+    base::endRecord(begin);
+  }
+
+  // Read-only input
+  template <typename TAnyChar>
+  void parse(TAnyChar *begin, TAnyChar *end) {
+    copyAndParse(begin, end);
+  }
+
+  void copyAndParse(const TChar *begin, const TChar *end) {
+    typename TJsonBuffer::String str = base::_buffer->startString();
+    str.append(reinterpret_cast<const char *>(begin), size_t(end - begin));
+    base::endRecord(str.c_str());
+  }
+
+  TChar *_ptr;
+  TChar *_end;
+};
+
+// Splits a range of JSON Lines, or a JSON text sequence, in parts of roughly
+// the same size, at the record boundaries.
+// Each part can then be given to its own JsonLinesReader, with its own
+// JsonBuffer, for example to process the parts in parallel.
+// The documents keep the order of the input if the parts are consumed in
+// order.
+//
+// bounds receives partCount + 1 pointers: the part i is from bounds[i] to
+// bounds[i + 1]. A part is empty if a record is bigger than the part size.
+template <typename TChar>
+void splitJsonLines(TChar *begin, TChar *end, TChar **bounds,
+                    size_t partCount) {
+  // same rule as JsonLinesReader: RS if the first record begins with it
+  TChar *first = begin;
+  while (first < end && (*first == ' ' || *first == '\t' || *first == '\r' ||
+                         *first == '\n'))
+    first++;
+  char separator = first < end && *first == 0x1E ? char(0x1E) : '\n';
+
+  size_t size = size_t(end - begin);
+  bounds[0] = begin;
+  for (size_t i = 1; i < partCount; i++) {
+    TChar *p = begin + size / partCount * i;
+    if (p < bounds[i - 1]) p = bounds[i - 1];
+    // in a sequence, the RS begins the record, with JSON Lines, the newline
+    // ends it
+    TChar *sep = static_cast<TChar *>(memchr(p, separator, size_t(end - p)));
+    bounds[i] = sep ? (separator == '\n' ? sep + 1 : sep) : end;
+  }
+  bounds[partCount] = end;
+}
+}  // namespace ArduinoJson
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include "Configuration.hpp"
 #include "Data/JsonBufferAllocated.hpp"
+#include "Data/JsonObjectIndex.hpp"
 #include "Data/List.hpp"
 #include "Data/ReferenceType.hpp"
 #include "Data/ValueSaver.hpp"
@@ -18,6 +20,10 @@
 
 // Returns the size (in bytes) of an object with n elements.
 // Can be very handy to determine the size of a StaticJsonBuffer.
+// sizeof(JsonObject) includes the head of the list: the pointers to the first
+// and last nodes, and the number of nodes (two words more than a bare list),
+// plus the pointer to the hash table when ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+// is set. The hash table itself is not included.
 #define JSON_OBJECT_SIZE(NUMBER_OF_ELEMENTS) \
   (sizeof(JsonObject) + (NUMBER_OF_ELEMENTS) * sizeof(JsonObject::node_type))
 
@@ -27,6 +33,9 @@ namespace ArduinoJson {
 class JsonArray;
 class JsonBuffer;
 namespace Internals {
+class JsonCompactor;
+template <size_t>
+class DuplicateKeyFinder;
 template <typename>
 class JsonObjectSubscript;
 }
@@ -47,7 +56,13 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
   // You should not use this constructor directly.
   // Instead, use JsonBuffer::createObject() or JsonBuffer.parseObject().
   explicit JsonObject(JsonBuffer* buffer) throw()
-      : Internals::List<JsonPair>(buffer) {}
+      : Internals::List<JsonPair>(buffer)
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD > 0
+        ,
+        _index(NULL)
+#endif
+  {
+  }
 
   // Gets or sets the value associated with the specified key.
   //
@@ -251,7 +266,40 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
   }
   //
   // void remove(iterator)
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD > 0
+  void remove(iterator it) {
+    if (it == end() || !index()) {
+      Internals::List<JsonPair>::remove(it);
+      return;
+    }
+    const char* key = it->key;
+    _index->remove(&*it);
+    Internals::List<JsonPair>::remove(it);
+    _index->removed(lastNode(), size());
+#if ARDUINOJSON_ASSUME_UNIQUE_KEYS
+    // the next pair with the same key (if any) is not hidden anymore
+    for (node_type* node = firstNode(); node; node = node->next) {
+      if (!strcmp(node->content.key, key)) {
+        _index->restore(node);
+        break;
+      }
+    }
+#else
+    (void)key;
+#endif
+  }
+#else
   using Internals::List<JsonPair>::remove;
+#endif
+
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD > 0
+  // Moves the pairs of another object to the end of this one.
+  // The index of this object still applies, the other one loses its nodes.
+  void splice(JsonObject& other) {
+    Internals::List<JsonPair>::splice(other);
+    if (!other.size() && other._index) other._index->clear();
+  }
+#endif
 
   // Returns a reference an invalid JsonObject.
   // This object is meant to replace a NULL pointer.
@@ -262,9 +310,16 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
   }
 
  private:
+  friend class Internals::JsonCompactor;
+  template <size_t>
+  friend class Internals::DuplicateKeyFinder;
+
   // Returns the list node that matches the specified key.
   template <typename TStringRef>
   iterator findKey(TStringRef key) {
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD > 0
+    if (index()) return iterator(_index->find<TStringRef>(key));
+#endif
     iterator it;
     for (it = begin(); it != end(); ++it) {
       if (Internals::StringTraits<TStringRef>::equals(key, it->key)) break;
@@ -297,7 +352,11 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
       if (it == end()) return false;
       bool key_ok =
           Internals::ValueSaver<TStringRef>::save(_buffer, it->key, key);
-      if (!key_ok) return false;
+      if (!key_ok) {
+        // a pair without a key must not stay in the list, nor in the index
+        Internals::List<JsonPair>::remove(it);
+        return false;
+      }
     }
 
     // save the value
@@ -315,6 +374,21 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
 
   template <typename TStringRef>
   JsonObject& createNestedObject_impl(TStringRef key);
+
+#if ARDUINOJSON_OBJECT_INDEX_THRESHOLD > 0
+  // Brings the index up to date with the list, or creates it once the object
+  // is big enough. Returns NULL if the object has no index.
+  Internals::JsonObjectIndex* index() {
+    if (_index && !_index->update(firstNode())) _index = NULL;
+    if (!_index && size() > ARDUINOJSON_OBJECT_INDEX_THRESHOLD) {
+      _index = Internals::JsonObjectIndex::create(_buffer, size());
+      if (_index && !_index->update(firstNode())) _index = NULL;
+    }
+    return _index;
+  }
+
+  Internals::JsonObjectIndex* _index;
+#endif
 };
 
 namespace Internals {
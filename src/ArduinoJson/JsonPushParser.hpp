@@ -0,0 +1,373 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for strlen
+
+#include "Configuration.hpp"
+#include "Data/Encoding.hpp"
+#include "Deserialization/CharClasses.hpp"
+#include "Deserialization/decodeLiteral.hpp"
+#include "JsonArray.hpp"
+#include "JsonObject.hpp"
+#include "JsonVariant.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// The statuses are shared by all instances of the template, so that they can
+// be compared regardless of the buffer type and the depth.
+class JsonPushParserBase {
+ public:
+  enum Status {
+    NEED_MORE,      // the document is incomplete, call feed() again
+    DONE,           // the document is complete, call result()
+    INVALID_INPUT,  // the input is not a valid JSON document
+    NO_MEMORY,      // the JsonBuffer is full
+    TOO_DEEP        // the nesting exceeds MAX_DEPTH
+  };
+};
+}  // namespace Internals
+
+// An incremental parser that accepts the input in chunks of any size.
+//
+// Unlike JsonBuffer::parse(), it never waits for more input: feed() consumes
+// everything it's given and returns NEED_MORE until the document is complete.
+// The state lives in the object (including an explicit stack of open
+// containers), so it can be fed from an event loop, as the data arrives.
+//
+// The values are stored in the JsonBuffer passed to the constructor, and the
+// strings are copied, so the chunks can be discarded after each call.
+//
+// MAX_DEPTH is the maximum number of nested arrays and objects, it plays the
+// same role as the nestingLimit argument of JsonBuffer::parse().
+template <typename TJsonBuffer,
+          size_t MAX_DEPTH = ARDUINOJSON_DEFAULT_NESTING_LIMIT>
+class JsonPushParser : public Internals::JsonPushParserBase {
+ public:
+  explicit JsonPushParser(TJsonBuffer &buffer)
+      : _buffer(&buffer),
+        _string(buffer.startString()),
+        _status(NEED_MORE),
+        _state(VALUE),
+        _stateAfterComment(VALUE),
+        _stopChar(0),
+        _isKey(false),
+        _key(NULL),
+        _depth(0) {}
+
+  // Parses the next chunk of the document.
+  // Once the result is known (i.e. anything but NEED_MORE), the remaining
+  // input is ignored.
+  Status feed(const char *data, size_t length) {
+    const char *end = data + length;
+    while (_status == NEED_MORE && data < end) data = step(data, end);
+    return _status;
+  }
+
+  Status feed(const char *data) {
+    return feed(data, strlen(data));
+  }
+
+  // Tells the parser that there is no more input.
+  // This is required when the root is a number, a boolean or null, because
+  // there is no way to tell whether it's complete until then.
+  Status finish() {
+    if (_status != NEED_MORE) return _status;
+    if (_state == NON_QUOTED && _depth == 0 && !_isKey) {
+      endString();
+    } else {
+      _status = INVALID_INPUT;
+    }
+    return _status;
+  }
+
+  Status status() const {
+    return _status;
+  }
+
+  // Returns the parsed value, or an undefined variant if not DONE.
+  JsonVariant result() const {
+    return _status == DONE ? _root : JsonVariant();
+  }
+
+ private:
+  enum State {
+    VALUE,               // before a value
+    ARRAY_START,         // after '['
+    OBJECT_START,        // after '{'
+    KEY,                 // before a key
+    COLON,               // after a key
+    SEPARATOR,           // after a value in an array or an object
+    QUOTED,              // in a string with quotes
+    ESCAPE,              // after a backslash in a string with quotes
+    NON_QUOTED,          // in a string without quotes (or a number, etc.)
+    COMMENT_START,       // after a '/'
+    BLOCK_COMMENT,       // in a /* comment */
+    BLOCK_COMMENT_STAR,  // after a '*' in a /* comment */
+    LINE_COMMENT         // in a // comment
+  };
+
+  struct Container {
+    JsonArray *array;  // NULL if it's an object
+    JsonObject *object;
+  };
+
+  JsonPushParser &operator=(const JsonPushParser &);  // non-copiable
+
+  // Consumes one or more characters, or switches to a state that can consume
+  // the current character.
+  const char *step(const char *p, const char *end) {
+    char c = *p;
+
+    switch (_state) {
+      case QUOTED: {
+        // append all the characters that need no special treatment at once
+        const char *begin = p;
+        while (p < end && *p != _stopChar && *p != '\\' && *p != '\0') p++;
+        if (p != begin) _string.append(begin, size_t(p - begin));
+        if (p == end) return p;
+        if (*p == '\0') return fail(INVALID_INPUT, p);
+        if (*p == '\\')
+          _state = ESCAPE;
+        else
+          endString();
+        return p + 1;
+      }
+
+      case ESCAPE:
+        c = Internals::Encoding::unescapeChar(c);
+        if (c == '\0') return fail(INVALID_INPUT, p);
+        _string.append(c);
+        _state = QUOTED;
+        return p + 1;
+
+      case NON_QUOTED: {
+        const char *begin = p;
+        while (p < end && Internals::canBeInNonQuotedString(*p)) p++;
+        if (p != begin) _string.append(begin, size_t(p - begin));
+        // like JsonParser, any other character ends the string
+        if (p != end) endString();
+        return p;
+      }
+
+      case COMMENT_START:
+        if (c == '*')
+          _state = BLOCK_COMMENT;
+        else if (c == '/')
+          _state = LINE_COMMENT;
+        else
+          return fail(INVALID_INPUT, p);
+        return p + 1;
+
+      case BLOCK_COMMENT:
+        if (c == '*') _state = BLOCK_COMMENT_STAR;
+        return p + 1;
+
+      case BLOCK_COMMENT_STAR:
+        if (c == '/')
+          _state = _stateAfterComment;
+        else if (c != '*')
+          _state = BLOCK_COMMENT;
+        return p + 1;
+
+      case LINE_COMMENT:
+        if (c == '\n') _state = _stateAfterComment;
+        return p + 1;
+
+      default:
+        break;
+    }
+
+    // all the other states skip spaces and comments
+    switch (c) {
+      case ' ':
+      case '\t':
+      case '\r':
+      case '\n':
+        return p + 1;
+
+      case '/':
+        _stateAfterComment = _state;
+        _state = COMMENT_START;
+        return p + 1;
+
+      case '\0':
+        return fail(INVALID_INPUT, p);
+
+      default:
+        break;
+    }
+
+    switch (_state) {
+      case ARRAY_START:
+        if (c == ']') return closeContainer(p);
+        _state = VALUE;
+        return p;
+
+      case OBJECT_START:
+        if (c == '}') return closeContainer(p);
+        _state = KEY;
+        return p;
+
+      case VALUE:
+        if (c == '[' || c == '{') return openContainer(p);
+        beginString(p, false);
+        return Internals::isQuote(c) ? p + 1 : p;
+
+      case KEY:
+        beginString(p, true);
+        return Internals::isQuote(c) ? p + 1 : p;
+
+      case COLON:
+        if (c != ':') return fail(INVALID_INPUT, p);
+        _state = VALUE;
+        return p + 1;
+
+      case SEPARATOR:
+        if (c == (top().array ? ']' : '}')) return closeContainer(p);
+        if (c != ',') return fail(INVALID_INPUT, p);
+        _state = top().array ? VALUE : KEY;
+        return p + 1;
+
+      default:
+        return fail(INVALID_INPUT, p);
+    }
+  }
+
+  const char *fail(Status status, const char *p) {
+    _status = status;
+    return p;
+  }
+
+  Container &top() {
+    return _stack[_depth - 1];
+  }
+
+  void beginString(const char *p, bool isKey) {
+    // must be called after the previous allocation, so that the string is
+    // contiguous
+    _string = _buffer->startString();
+    _isKey = isKey;
+    if (Internals::isQuote(*p)) {
+      _stopChar = *p;
+      _state = QUOTED;
+    } else {
+      _stopChar = 0;
+      _state = NON_QUOTED;
+    }
+  }
+
+  void endString() {
+    const char *s = _string.c_str();
+    if (s == NULL) {
+      _status = NO_MEMORY;
+      return;
+    }
+    // JsonParser accepts empty values in arrays and objects, but an empty
+    // document is not a document
+    if (!_stopChar && !*s && _depth == 0 && !_isKey) {
+      _status = INVALID_INPUT;
+      return;
+    }
+    if (_isKey) {
+      _isKey = false;
+      _key = s;
+      _state = COLON;
+      return;
+    }
+    JsonVariant value;
+    if (_stopChar) {
+      value = s;
+    } else {
+#if ARDUINOJSON_EAGER_DECODING
+      if (!Internals::decodeLiteral(s, &value))
+#endif
+        value = RawJson(s);
+    }
+    addValue(value);
+  }
+
+  const char *openContainer(const char *p) {
+    if (_depth == MAX_DEPTH) return fail(TOO_DEEP, p);
+    Container container = {NULL, NULL};
+    JsonVariant value;
+    if (*p == '[') {
+      container.array = &_buffer->createArray();
+      if (!container.array->success()) return fail(NO_MEMORY, p);
+      value = *container.array;
+      _state = ARRAY_START;
+    } else {
+      container.object = &_buffer->createObject();
+      if (!container.object->success()) return fail(NO_MEMORY, p);
+      value = *container.object;
+      _state = OBJECT_START;
+    }
+    // attach to the parent now, the state will be restored when it's closed
+    State state = _state;
+    addValue(value);
+    _state = state;
+    _stack[_depth++] = container;
+    return p + 1;
+  }
+
+  const char *closeContainer(const char *p) {
+    _depth--;
+    if (_depth == 0)
+      _status = DONE;
+    else
+      _state = SEPARATOR;
+    return p + 1;
+  }
+
+  void addValue(JsonVariant value) {
+    _state = SEPARATOR;
+    if (_depth == 0) {
+      _root = value;
+      // containers are DONE when they're closed
+      if (!value.is<JsonArray>() && !value.is<JsonObject>()) _status = DONE;
+      return;
+    }
+    Container &parent = top();
+    bool ok = parent.array ? parent.array->add(value)
+                           : parent.object->set(_key, value);
+    if (!ok) _status = NO_MEMORY;
+  }
+
+  TJsonBuffer *_buffer;
+  typename TJsonBuffer::String _string;
+  Status _status;
+  State _state;
+  State _stateAfterComment;
+  char _stopChar;
+  bool _isKey;
+  const char *_key;
+  JsonVariant _root;
+  Container _stack[MAX_DEPTH > 0 ? MAX_DEPTH : 1];
+  size_t _depth;
+};
+
+// Parses a complete document with a JsonPushParser, i.e. without recursion.
+// Unlike JsonBuffer::parse(), the call stack doesn't grow with the nesting,
+// and the nesting is not limited to 255 levels: the parser (and its stack of
+// MAX_DEPTH containers) lives in the stack frame of this function, so the
+// memory needed is known at compile time.
+//
+// Returns an undefined variant if the parsing fails.
+//
+// JsonVariant parseIteratively<MAX_DEPTH>(TJsonBuffer&, const char*);
+template <size_t MAX_DEPTH, typename TJsonBuffer>
+JsonVariant parseIteratively(TJsonBuffer &buffer, const char *json,
+                             size_t length) {
+  JsonPushParser<TJsonBuffer, MAX_DEPTH> parser(buffer);
+  if (parser.feed(json, length) == parser.NEED_MORE) parser.finish();
+  return parser.result();
+}
+
+template <size_t MAX_DEPTH, typename TJsonBuffer>
+JsonVariant parseIteratively(TJsonBuffer &buffer, const char *json) {
+  return parseIteratively<MAX_DEPTH>(buffer, json, strlen(json));
+}
+}  // namespace ArduinoJson
@@ -0,0 +1,49 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "Deserialization/JsonValidator.hpp"
+
+namespace ArduinoJson {
+
+// Checks that JsonBuffer::parse() would succeed, without allocating anything.
+// The input is not modified, even if it's a char*.
+//
+// If bufferSize is not NULL, it receives the number of bytes that parse()
+// needs, i.e. the capacity of a StaticJsonBuffer, or the initialSize of a
+// DynamicJsonBuffer so that it allocates a single block. It includes the
+// arrays, the objects, the strings (unless the input is a char*) and the
+// padding.
+// It's exact unless an object has duplicate keys, in which case it's a bit
+// more than needed (except with ARDUINOJSON_ASSUME_UNIQUE_KEYS, where the
+// duplicates are stored too).
+//
+// Returns false if the input is invalid.
+//
+// bool validateJson(TString, size_t* bufferSize);
+// TString = const std::string&, const String&
+template <typename TString>
+typename Internals::EnableIf<!Internals::IsArray<TString>::value, bool>::type
+validateJson(const TString &json, size_t *bufferSize = NULL,
+             uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+  return Internals::validateJson(json, bufferSize, nestingLimit);
+}
+//
+// bool validateJson(TString, size_t* bufferSize);
+// TString = char*, const char*, const char[N], const FlashStringHelper*
+template <typename TString>
+bool validateJson(TString *json, size_t *bufferSize = NULL,
+                  uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+  return Internals::validateJson(json, bufferSize, nestingLimit);
+}
+//
+// bool validateJson(TString, size_t* bufferSize);
+// TString = std::istream&, Stream&
+template <typename TString>
+bool validateJson(TString &json, size_t *bufferSize = NULL,
+                  uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
+  return Internals::validateJson(json, bufferSize, nestingLimit);
+}
+}  // namespace ArduinoJson
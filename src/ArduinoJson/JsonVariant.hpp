@@ -28,6 +28,9 @@ namespace ArduinoJson {
 // Forward declarations.
 class JsonArray;
 class JsonObject;
+namespace Internals {
+class JsonCompactor;
+}
 
 // A variant that can be a any value serializable to a JSON value.
 //
@@ -39,6 +42,7 @@ class JsonObject;
 class JsonVariant : public Internals::JsonVariantBase<JsonVariant> {
   template <typename Print>
   friend class Internals::JsonSerializer;
+  friend class Internals::JsonCompactor;
 
  public:
   // Creates an uninitialized JsonVariant
@@ -90,7 +94,8 @@ class JsonVariant : public Internals::JsonVariantBase<JsonVariant> {
       _content.asInteger = static_cast<JsonUInt>(value);
     } else {
       _type = JSON_NEGATIVE_INTEGER;
-      _content.asInteger = static_cast<JsonUInt>(-value);
+      // negates in the unsigned type, because -value overflows for the min
+      _content.asInteger = ~static_cast<JsonUInt>(value) + 1;
     }
   }
   // JsonVariant(unsigned short)
@@ -124,6 +129,13 @@ class JsonVariant : public Internals::JsonVariantBase<JsonVariant> {
     _content.asString = value;
   }
 
+  // Create a JsonVariant containing an array or an object that is not parsed
+  // yet, see JsonBuffer::parseObjectLazily()
+  explicit JsonVariant(Internals::LazyJson *value) {
+    _type = Internals::JSON_LAZY;
+    _content.asLazy = value;
+  }
+
   // Create a JsonVariant containing a reference to an array.
   // CAUTION: we are lying about constness, because the array can be modified if
   // the variant is converted back to a JsonArray&
@@ -326,12 +338,8 @@ class JsonVariant : public Internals::JsonVariantBase<JsonVariant> {
   bool variantIsBoolean() const;
   bool variantIsFloat() const;
   bool variantIsInteger() const;
-  bool variantIsArray() const {
-    return _type == Internals::JSON_ARRAY;
-  }
-  bool variantIsObject() const {
-    return _type == Internals::JSON_OBJECT;
-  }
+  bool variantIsArray() const;
+  bool variantIsObject() const;
   bool variantIsString() const {
     return _type == Internals::JSON_STRING ||
            (_type == Internals::JSON_UNPARSED && _content.asString &&
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Configuration.hpp"
+#include "Data/LazyJson.hpp"
 #include "JsonArray.hpp"
 #include "JsonObject.hpp"
 #include "JsonVariant.hpp"
@@ -37,19 +38,34 @@ inline JsonVariant::JsonVariant(const JsonObject &object) {
 
 inline JsonArray &JsonVariant::variantAsArray() const {
   if (_type == Internals::JSON_ARRAY) return *_content.asArray;
+  if (_type == Internals::JSON_LAZY)
+    return _content.asLazy->expand().variantAsArray();
   return JsonArray::invalid();
 }
 
 inline JsonObject &JsonVariant::variantAsObject() const {
   if (_type == Internals::JSON_OBJECT) return *_content.asObject;
+  if (_type == Internals::JSON_LAZY)
+    return _content.asLazy->expand().variantAsObject();
   return JsonObject::invalid();
 }
 
+inline bool JsonVariant::variantIsArray() const {
+  return _type == Internals::JSON_ARRAY ||
+         (_type == Internals::JSON_LAZY && _content.asLazy->isArray());
+}
+
+inline bool JsonVariant::variantIsObject() const {
+  return _type == Internals::JSON_OBJECT ||
+         (_type == Internals::JSON_LAZY && _content.asLazy->isObject());
+}
+
 template <typename T>
 inline T JsonVariant::variantAsInteger() const {
   using namespace Internals;
   switch (_type) {
     case JSON_UNDEFINED:
+    case JSON_LAZY:
       return 0;
     case JSON_POSITIVE_INTEGER:
     case JSON_BOOLEAN:
@@ -78,6 +94,7 @@ inline T JsonVariant::variantAsFloat() const {
   using namespace Internals;
   switch (_type) {
     case JSON_UNDEFINED:
+    case JSON_LAZY:
       return 0;
     case JSON_POSITIVE_INTEGER:
     case JSON_BOOLEAN:
@@ -5,14 +5,19 @@
 #pragma once
 
 #include "./ctype.hpp"
+#include "./parseInteger.hpp"
 
 namespace ArduinoJson {
 namespace Internals {
 
+// Returns false if the number doesn't fit in a JsonUInt, or in a JsonInteger
+// if it's negative, as it can only be stored as a float.
 inline bool isInteger(const char* s) {
   if (!s || !*s) return false;
+  bool negative = *s == '-';
   if (issign(*s)) s++;
-  while (isdigit(*s)) s++;
+  JsonUInt value;
+  if (!parseDigits(s, value, maxMagnitude(negative))) return false;
   return *s == '\0';
 }
 }  // namespace Internals
@@ -37,12 +37,15 @@ inline T parseFloat(const char* s) {
 
   mantissa_t mantissa = 0;
   exponent_t exponent_offset = 0;
+  bool truncated = false;  // true if a non-zero digit didn't fit
 
   while (isdigit(*s)) {
     if (mantissa < traits::mantissa_max / 10)
       mantissa = mantissa * 10 + (*s - '0');
-    else
+    else {
       exponent_offset++;
+      if (*s != '0') truncated = true;
+    }
     s++;
   }
 
@@ -52,6 +55,8 @@ inline T parseFloat(const char* s) {
       if (mantissa < traits::mantissa_max / 10) {
         mantissa = mantissa * 10 + (*s - '0');
         exponent_offset--;
+      } else if (*s != '0') {
+        truncated = true;
       }
       s++;
     }
@@ -82,7 +87,17 @@ inline T parseFloat(const char* s) {
   }
   exponent += exponent_offset;
 
-  T result = traits::make_float(static_cast<T>(mantissa), exponent);
+  T result;
+  if (!truncated && exponent >= -traits::exact_exponent_max &&
+      exponent <= traits::exact_exponent_max) {
+    // Both the mantissa and the power of ten are exact, so a single
+    // multiplication or division gives the correctly rounded result.
+    T power = traits::make_float(T(1), exponent < 0 ? -exponent : exponent);
+    result = exponent < 0 ? static_cast<T>(mantissa) / power
+                          : static_cast<T>(mantissa) * power;
+  } else {
+    result = traits::make_float(static_cast<T>(mantissa), exponent);
+  }
 
   return negative_result ? -result : result;
 }
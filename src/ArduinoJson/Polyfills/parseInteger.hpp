@@ -4,20 +4,68 @@
 
 #pragma once
 
+#include <stdint.h>  // for uint8_t
 #include <stdlib.h>
 
 #include "../Configuration.hpp"
+#include "../Data/JsonInteger.hpp"
 #include "./ctype.hpp"
 
 namespace ArduinoJson {
 namespace Internals {
+
+// Returns the greatest magnitude of an integer: the maximum of JsonUInt for a
+// positive number, and the magnitude of the minimum of JsonInteger for a
+// negative one.
+inline JsonUInt maxMagnitude(bool negative) {
+  const JsonUInt maxValue = JsonUInt(~JsonUInt(0));
+  return negative ? maxValue / 2 + 1 : maxValue;
+}
+
+// Returns the greatest magnitude of a T: its maximum for a positive number,
+// and the magnitude of its minimum for a negative one (0 if T is unsigned).
+template <typename T>
+JsonUInt maxMagnitudeOf(bool negative) {
+  // shifted in two steps, so that it's not shifted by the whole width
+  const size_t halfBits =
+      4 * (sizeof(T) < sizeof(JsonUInt) ? sizeof(T) : sizeof(JsonUInt));
+  const JsonUInt maxValue = (JsonUInt(1) << halfBits << halfBits) - 1;
+  if (T(-1) > T(0)) return negative ? 0 : maxValue;
+  return negative ? maxValue / 2 + 1 : maxValue / 2;
+}
+
+// Reads the digits at s into result, and stops at the first non-digit.
+// Returns false if the number is greater than maxValue.
+inline bool parseDigits(const char *&s, JsonUInt &result, JsonUInt maxValue) {
+  // A JsonUInt holds at least 2.4 decimal digits per byte, so the first
+  // digits can't overflow and only need to be checked once.
+  const uint8_t safeDigits = sizeof(JsonUInt) * 12 / 5;
+
+  JsonUInt value = 0;
+  for (uint8_t i = 0; i < safeDigits && isdigit(*s); i++, s++) {
+    value = value * 10 + JsonUInt(*s - '0');
+  }
+  if (value > maxValue) return false;
+
+  while (isdigit(*s)) {
+    JsonUInt digit = JsonUInt(*s - '0');
+    if (value > (maxValue - digit) / 10) return false;
+    value = value * 10 + digit;
+    s++;
+  }
+
+  result = value;
+  return true;
+}
+
+// Returns 0 if the number doesn't fit in a T, including a negative number
+// for an unsigned T.
 template <typename T>
 T parseInteger(const char *s) {
   if (!s) return 0;  // NULL
 
   if (*s == 't') return 1;  // "true"
 
-  T result = 0;
   bool negative_result = false;
 
   switch (*s) {
@@ -30,12 +78,10 @@ T parseInteger(const char *s) {
       break;
   }
 
-  while (isdigit(*s)) {
-    result = T(result * 10 + T(*s - '0'));
-    s++;
-  }
+  JsonUInt result;
+  if (!parseDigits(s, result, maxMagnitudeOf<T>(negative_result))) return 0;
 
-  return negative_result ? T(~result + 1) : result;
+  return negative_result ? T(~result + 1) : T(result);
 }
 }
 }
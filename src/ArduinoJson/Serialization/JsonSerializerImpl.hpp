@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "../Data/LazyJson.hpp"
 #include "../JsonArray.hpp"
 #include "../JsonArraySubscript.hpp"
 #include "../JsonObject.hpp"
@@ -86,6 +87,14 @@ inline void ArduinoJson::Internals::JsonSerializer<Writer>::serialize(
       writer.writeRaw(variant._content.asString);
       return;
 
+    case JSON_LAZY:
+      // the original text, unless it has been parsed (and maybe modified)
+      if (variant._content.asLazy->isExpanded())
+        serialize(variant._content.asLazy->expand(), writer);
+      else
+        writer.writeRaw(variant._content.asLazy->json());
+      return;
+
     case JSON_NEGATIVE_INTEGER:
       writer.writeRaw('-');  // Falls through.
 
@@ -24,6 +24,13 @@ class StaticJsonBufferBase : public JsonBufferBase<StaticJsonBufferBase> {
       }
     }
 
+    void append(const char* s, size_t n) {
+      // like append(char), keeps as many characters as possible
+      size_t available = _parent->_capacity - _parent->_size;
+      if (n > available) n = available;
+      memcpy(_parent->doAlloc(n), s, n);
+    }
+
     const char* c_str() const {
       if (_parent->canAlloc(1)) {
         char* last = static_cast<char*>(_parent->doAlloc(1));
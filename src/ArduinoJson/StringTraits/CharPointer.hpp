@@ -7,9 +7,17 @@
 namespace ArduinoJson {
 namespace Internals {
 
+// A tag for the readers whose characters are contiguous in RAM.
+// The parser uses ptr() and jump() to scan these inputs by spans, instead of
+// calling current() and move() for every character.
+struct ContiguousReader {};
+
+template <typename TReader>
+struct IsContiguousReader : IsBaseOf<ContiguousReader, TReader> {};
+
 template <typename TChar>
 struct CharPointerTraits {
-  class Reader {
+  class Reader : public ContiguousReader {
     const TChar* _ptr;
 
    public:
@@ -27,6 +35,16 @@ struct CharPointerTraits {
     char next() const {
       return char(_ptr[1]);
     }
+
+    // Returns a pointer to the current character
+    const char* ptr() const {
+      return reinterpret_cast<const char*>(_ptr);
+    }
+
+    // Moves to the specified character, as returned by ptr()
+    void jump(const char* p) {
+      _ptr = reinterpret_cast<const TChar*>(p);
+    }
   };
 
   static bool equals(const TChar* str, const char* expected) {
@@ -39,7 +39,17 @@ struct StdStreamTraits {
     Reader& operator=(const Reader&);  // Visual Studio C4512
 
     char read() {
-      return _stream.eof() ? '\0' : static_cast<char>(_stream.get());
+      // Read from the streambuf directly: istream::get() constructs a sentry
+      // for each character, whereas sbumpc() only makes a virtual call when
+      // the streambuf needs to refill its buffer.
+      std::streambuf* buf = _stream.rdbuf();
+      if (_stream.eof() || !buf) return '\0';
+      std::streambuf::int_type c = buf->sbumpc();
+      if (c == std::streambuf::traits_type::eof()) {
+        _stream.setstate(std::ios::eofbit);
+        return '\0';
+      }
+      return static_cast<char>(c);
     }
   };
 
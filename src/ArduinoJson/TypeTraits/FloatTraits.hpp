@@ -25,6 +25,9 @@ struct FloatTraits<T, 8 /*64bits*/> {
   typedef int16_t exponent_type;
   static const exponent_type exponent_max = 308;
 
+  // Largest power of ten that is exactly representable
+  static const exponent_type exact_exponent_max = 22;
+
   template <typename TExponent>
   static T make_float(T m, TExponent e) {
     if (e > 0) {
@@ -118,6 +121,9 @@ struct FloatTraits<T, 4 /*32bits*/> {
   typedef int8_t exponent_type;
   static const exponent_type exponent_max = 38;
 
+  // Largest power of ten that is exactly representable
+  static const exponent_type exact_exponent_max = 10;
+
   template <typename TExponent>
   static T make_float(T m, TExponent e) {
     if (e > 0) {
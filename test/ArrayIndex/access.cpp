@@ -0,0 +1,99 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#define ARDUINOJSON_ARRAY_INDEX_THRESHOLD 4
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("ARDUINOJSON_ARRAY_INDEX_THRESHOLD") {
+  DynamicJsonBuffer jb;
+  JsonArray& arr = jb.createArray();
+  for (int i = 0; i < 100; i++) arr.add(i);
+
+  SECTION("get() and operator[]") {
+    for (int i = 0; i < 100; i++) {
+      REQUIRE(arr.get<int>(size_t(i)) == i);
+      REQUIRE(arr[size_t(i)] == i);
+    }
+    REQUIRE(arr.get<int>(100) == 0);
+    REQUIRE_FALSE(arr[100].success());
+  }
+
+  SECTION("set() and is()") {
+    REQUIRE(arr.set(42, "hello"));
+    REQUIRE(arr.is<const char*>(42));
+    REQUIRE(arr[42] == "hello");
+    REQUIRE_FALSE(arr.set(100, 1));
+    REQUIRE(arr.size() == 100);
+  }
+
+  SECTION("add() after an access") {
+    REQUIRE(arr[99] == 99);
+    for (int i = 100; i < 200; i++) arr.add(i);
+    for (int i = 0; i < 200; i++) REQUIRE(arr[size_t(i)] == i);
+  }
+
+  SECTION("remove()") {
+    REQUIRE(arr[99] == 99);
+    arr.remove(0);
+    arr.remove(arr.begin());
+    arr.remove(97);
+
+    REQUIRE(arr.size() == 97);
+    REQUIRE(arr[0] == 2);
+    REQUIRE(arr[96] == 98);
+    REQUIRE_FALSE(arr[97].success());
+  }
+
+  SECTION("parseArray()") {
+    JsonArray& parsed = jb.parseArray("[0,1,2,3,4,5,6,7,8,9]");
+    for (int i = 0; i < 10; i++) REQUIRE(parsed[size_t(i)] == i);
+  }
+
+  SECTION("splice()") {
+    REQUIRE(arr[99] == 99);
+    JsonArray& other = jb.createArray();
+    for (int i = 0; i < 10; i++) other.add(100 + i);
+    REQUIRE(other[9] == 109);
+
+    arr.splice(other);
+    REQUIRE(arr[109] == 109);
+    REQUIRE_FALSE(other[0].success());
+    other.add(1);
+    REQUIRE(other[0] == 1);
+  }
+
+  SECTION("splice(), then refill") {
+    REQUIRE(arr[99] == 99);
+    JsonArray& receiver = jb.createArray();
+    receiver.splice(arr);
+    receiver.add(100);
+    for (int i = 0; i < 150; i++) arr.add(1000 + i);
+
+    REQUIRE(arr.size() == 150);
+    REQUIRE(arr[0] == 1000);
+    REQUIRE(arr[149] == 1149);
+    REQUIRE_FALSE(arr[150].success());
+    REQUIRE(receiver[100] == 100);
+  }
+
+  SECTION("copyCompactly()") {
+    DynamicJsonBuffer compact;
+    JsonArray& copy = compact.copyCompactly(arr);
+    jb.clear();
+
+    for (int i = 0; i < 100; i++) REQUIRE(copy[size_t(i)] == i);
+  }
+
+  SECTION("when the JsonBuffer is full") {
+    StaticJsonBuffer<JSON_ARRAY_SIZE(10)> small;
+    JsonArray& full = small.createArray();
+    for (int i = 0; i < 10; i++) REQUIRE(full.add(i));
+
+    for (int i = 0; i < 10; i++) REQUIRE(full[size_t(i)] == i);
+    full.remove(3);
+    REQUIRE(full[3] == 4);
+  }
+}
@@ -57,6 +57,19 @@ TEST_CASE("DynamicJsonBuffer::alloc()") {
     REQUIRE(allocatorLog.str() == "A1A2FFA1F");
   }
 
+  SECTION("Keeps the largest block after recycle()") {
+    allocatorLog.str("");
+    {
+      DynamicJsonBufferBase<SpyingAllocator> buffer(1);
+      buffer.alloc(1);
+      buffer.alloc(2);
+      buffer.recycle();
+      REQUIRE(buffer.size() == 0);
+      buffer.alloc(2);
+    }
+    REQUIRE(allocatorLog.str() == "A1A2FF");
+  }
+
   SECTION("Makes a big allocation when needed") {
     allocatorLog.str("");
     {
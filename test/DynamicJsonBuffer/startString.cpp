@@ -32,6 +32,18 @@ TEST_CASE("DynamicJsonBuffer::startString()") {
     REQUIRE(std::string("hello") == str.c_str());
   }
 
+  SECTION("AppendsSpans") {
+    DynamicJsonBuffer jsonBuffer(4);
+
+    DynamicJsonBuffer::String str = jsonBuffer.startString();
+    str.append("he", 2);
+    str.append("llo", 3);
+    str.append(' ');
+    str.append("world!", 5);
+
+    REQUIRE(std::string("hello world") == str.c_str());
+  }
+
   SECTION("SizeIncreases") {
     DynamicJsonBuffer jsonBuffer(5);
 
@@ -0,0 +1,197 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#define ARDUINOJSON_EAGER_DECODING 1
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+
+using namespace Catch::Matchers;
+using ArduinoJson::Internals::JsonInteger;
+using ArduinoJson::Internals::JsonUInt;
+
+TEST_CASE("ARDUINOJSON_EAGER_DECODING") {
+  DynamicJsonBuffer jb;
+
+  SECTION("Positive integer") {
+    JsonVariant variant = jb.parse("42");
+    REQUIRE(variant.is<int>());
+    REQUIRE(variant.as<int>() == 42);
+    REQUIRE(variant.as<char*>() == 0);
+  }
+
+  SECTION("Negative integer") {
+    JsonVariant variant = jb.parse("-42");
+    REQUIRE(variant.is<int>());
+    REQUIRE(variant.as<int>() == -42);
+  }
+
+  SECTION("Long min") {
+    JsonVariant variant = jb.parse("-2147483648");
+    REQUIRE(variant.is<long>());
+    REQUIRE(variant.as<long>() == -2147483647L - 1);
+  }
+
+  SECTION("Integer too big for JsonUInt") {
+    JsonVariant variant = jb.parse("123456789012345678901234567890");
+    REQUIRE_FALSE(variant.is<long>());
+    REQUIRE(variant.is<double>());
+    REQUIRE(variant.as<double>() == Approx(1.2345678901234568e+29));
+  }
+
+  SECTION("Integer too small for JsonInteger") {
+    JsonVariant variant = jb.parse("-123456789012345678901234567890");
+    REQUIRE_FALSE(variant.is<long>());
+    REQUIRE(variant.is<double>());
+    REQUIRE(variant.as<double>() == Approx(-1.2345678901234568e+29));
+  }
+
+  SECTION("Negative integer just below JsonInteger") {
+    const JsonUInt min = JsonUInt(~JsonUInt(0)) / 2 + 1;
+    std::ostringstream s;
+    s << '-' << min + 1;
+    JsonVariant variant = jb.parse(s.str());
+    REQUIRE_FALSE(variant.is<JsonInteger>());
+    REQUIRE(variant.is<double>());
+    REQUIRE(variant.as<double>() < 0);
+  }
+
+  SECTION("Minus maximum of JsonUInt") {
+    std::ostringstream s;
+    s << '-' << JsonUInt(~JsonUInt(0));
+    JsonVariant variant = jb.parse(s.str());
+    REQUIRE_FALSE(variant.is<JsonInteger>());
+    REQUIRE(variant.is<double>());
+    REQUIRE(variant.as<double>() < 0);
+  }
+
+  SECTION("Minimum of JsonInteger") {
+    const JsonUInt min = JsonUInt(~JsonUInt(0)) / 2 + 1;
+    std::ostringstream s;
+    s << '-' << min;
+    JsonVariant variant = jb.parse(s.str());
+    REQUIRE(variant.is<JsonInteger>());
+    REQUIRE(variant.as<JsonInteger>() < 0);
+    REQUIRE(variant.as<std::string>() == s.str());
+  }
+
+  SECTION("Minus zero") {
+    JsonVariant variant = jb.parse("-0");
+    REQUIRE(variant.is<int>());
+    REQUIRE(variant.as<int>() == 0);
+    REQUIRE(variant.as<std::string>() == "0");
+  }
+
+  SECTION("Float") {
+    JsonVariant variant = jb.parse("-1.23e+4");
+    REQUIRE_FALSE(variant.is<int>());
+    REQUIRE(variant.is<double>());
+    REQUIRE(variant.as<double>() == Approx(-1.23e+4));
+  }
+
+  SECTION("True") {
+    JsonVariant variant = jb.parse("true");
+    REQUIRE(variant.is<bool>());
+    REQUIRE(variant.as<bool>() == true);
+  }
+
+  SECTION("False") {
+    JsonVariant variant = jb.parse("false");
+    REQUIRE(variant.is<bool>());
+    REQUIRE(variant.as<bool>() == false);
+  }
+
+  SECTION("Null") {
+    JsonVariant variant = jb.parse("null");
+    REQUIRE(variant.success());
+    REQUIRE(variant.is<char*>());
+    REQUIRE(variant.as<char*>() == 0);
+  }
+
+  SECTION("Non-quoted string") {
+    JsonVariant variant = jb.parse("hello");
+    REQUIRE_THAT(variant.as<char*>(), Equals("hello"));
+  }
+
+  SECTION("Quoted number") {
+    JsonVariant variant = jb.parse("\"42\"");
+    REQUIRE(variant.is<char*>());
+    REQUIRE_THAT(variant.as<char*>(), Equals("42"));
+  }
+
+  SECTION("Number too long for the stack buffer") {
+    JsonVariant variant =
+        jb.parse("0.000000000000000000000000000000000000000012345");
+    REQUIRE(variant.is<double>());
+    REQUIRE(variant.as<double>() == Approx(1.2345e-41));
+  }
+
+  SECTION("Array") {
+    JsonArray& arr = jb.parseArray("[1,-2,3.5,true,false,null,abc]");
+    REQUIRE(arr.success());
+    REQUIRE(arr.size() == 7);
+    REQUIRE(arr[0] == 1);
+    REQUIRE(arr[1] == -2);
+    REQUIRE(arr[2] == 3.5);
+    REQUIRE(arr[3] == true);
+    REQUIRE(arr[4] == false);
+    REQUIRE(arr[5].as<char*>() == 0);
+    REQUIRE(arr[6] == "abc");
+  }
+
+  SECTION("Object in place") {
+    char json[] = "{a:1,\"b\":2.5,c:true,d:xyz}";
+    JsonObject& obj = jb.parseObject(json);
+    REQUIRE(obj.success());
+    REQUIRE(obj["a"] == 1);
+    REQUIRE(obj["b"] == 2.5);
+    REQUIRE(obj["c"] == true);
+    REQUIRE(obj["d"] == "xyz");
+  }
+
+  SECTION("Stream") {
+    std::istringstream json("[123, 4.5, null, true]");
+    JsonArray& arr = jb.parseArray(json);
+    REQUIRE(arr.success());
+    REQUIRE(arr[0] == 123);
+    REQUIRE(arr[1] == 4.5);
+    REQUIRE(arr[2].as<char*>() == 0);
+    REQUIRE(arr[3] == true);
+  }
+
+  SECTION("Doesn't store numbers in the JsonBuffer") {
+    StaticJsonBuffer<JSON_ARRAY_SIZE(4)> sjb;
+    JsonArray& arr = sjb.parseArray("[123456789,3.14159,false,null]");
+    REQUIRE(arr.success());
+    REQUIRE(sjb.size() == JSON_ARRAY_SIZE(4));
+  }
+
+  SECTION("Round trip") {
+    JsonArray& arr = jb.parseArray("[1,-2,3.5,true,false,null]");
+    std::string json;
+    arr.printTo(json);
+    REQUIRE(json == "[1,-2,3.5,true,false,null]");
+  }
+
+  SECTION("JsonPushParser") {
+    JsonPushParser<DynamicJsonBuffer> parser(jb);
+    parser.feed("[12");
+    parser.feed("3,tr");
+    REQUIRE(parser.feed("ue,\"4\"]") == parser.DONE);
+    JsonArray& arr = parser.result();
+    REQUIRE(arr[0].is<int>());
+    REQUIRE(arr[0] == 123);
+    REQUIRE(arr[1].is<bool>());
+    REQUIRE(arr[2].is<char*>());
+  }
+
+  SECTION("validateJson()") {
+    const char* json = "[1,-2,3.5,true,null,hello,\"4\"]";
+    size_t size = 0;
+    REQUIRE(validateJson(json, &size));
+    jb.parse(json);
+    REQUIRE(size == jb.size());
+  }
+}
@@ -0,0 +1,55 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("JsonArray::get()") {
+  DynamicJsonBuffer jb;
+  JsonArray& array = jb.createArray();
+  for (int i = 0; i < 10; i++) array.add(i);
+
+  SECTION("Forward") {
+    for (int i = 0; i < 10; i++) REQUIRE(i == array.get<int>(size_t(i)));
+  }
+
+  SECTION("Backward") {
+    for (int i = 9; i >= 0; i--) REQUIRE(i == array.get<int>(size_t(i)));
+  }
+
+  SECTION("Past the end") {
+    REQUIRE(9 == array.get<int>(9));
+    REQUIRE(0 == array.get<int>(10));
+    REQUIRE(9 == array.get<int>(9));
+  }
+
+  SECTION("After adding an element") {
+    REQUIRE(9 == array.get<int>(9));
+    array.add(10);
+    REQUIRE(10 == array.get<int>(10));
+  }
+
+  SECTION("After removing the visited element") {
+    REQUIRE(5 == array.get<int>(5));
+    array.remove(5);
+    REQUIRE(6 == array.get<int>(5));
+    REQUIRE(4 == array.get<int>(4));
+  }
+
+  SECTION("After removing a previous element") {
+    REQUIRE(5 == array.get<int>(5));
+    array.remove(size_t(0));
+    REQUIRE(6 == array.get<int>(5));
+  }
+
+  SECTION("After splicing into another array") {
+    REQUIRE(5 == array.get<int>(5));
+    JsonArray& other = jb.createArray();
+    other.splice(array);
+    REQUIRE(0 == array.get<int>(5));
+    array.add(42);
+    REQUIRE(42 == array.get<int>(0));
+    REQUIRE(5 == other.get<int>(5));
+  }
+}
@@ -32,4 +32,34 @@ TEST_CASE("JsonArray::size()") {
     _array[0] = "hello";
     REQUIRE(1U == _array.size());
   }
+
+  SECTION("decreases after remove()") {
+    _array.add("hello");
+    _array.add("world");
+
+    _array.remove(0);
+    REQUIRE(1U == _array.size());
+
+    _array.remove(0);
+    REQUIRE(0U == _array.size());
+  }
+
+  SECTION("remains the same after remove() with an iterator of another array") {
+    JsonArray& other = _jsonBuffer.createArray();
+    other.add("world");
+    _array.add("hello");
+
+    _array.remove(other.begin());
+    REQUIRE(1U == _array.size());
+    REQUIRE(1U == other.size());
+  }
+
+  SECTION("remains the same after a failed add()") {
+    StaticJsonBuffer<JSON_ARRAY_SIZE(1)> jb;
+    JsonArray& array = jb.createArray();
+    array.add("hello");
+
+    REQUIRE_FALSE(array.add("world"));
+    REQUIRE(1U == array.size());
+  }
 }
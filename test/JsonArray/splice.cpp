@@ -0,0 +1,69 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("JsonArray::splice()") {
+  DynamicJsonBuffer jb1, jb2;
+  JsonArray& array1 = jb1.createArray();
+  JsonArray& array2 = jb2.createArray();
+
+  SECTION("Moves the elements at the end") {
+    array1.add(1);
+    array2.add(2);
+    array2.add(3);
+
+    array1.splice(array2);
+
+    REQUIRE(3 == array1.size());
+    REQUIRE(array1[2] == 3);
+    REQUIRE(0 == array2.size());
+  }
+
+  SECTION("To an empty array") {
+    array2.add(1);
+
+    array1.splice(array2);
+
+    REQUIRE(1 == array1.size());
+    REQUIRE(0 == array2.size());
+  }
+
+  SECTION("Doesn't allocate") {
+    array2.add(1);
+    size_t size = jb1.size();
+
+    array1.splice(array2);
+
+    REQUIRE(size == jb1.size());
+  }
+
+  SECTION("To an invalid array") {
+    StaticJsonBuffer<1> tooSmall;
+    JsonArray& invalid = tooSmall.createArray();
+    JsonArray& parsed = jb2.parseArray("[1,2,3]");
+
+    invalid.splice(parsed);
+
+    REQUIRE(0 == JsonArray::invalid().size());
+    REQUIRE(3 == parsed.size());
+  }
+
+  SECTION("From an invalid array") {
+    array1.add(1);
+
+    array1.splice(JsonArray::invalid());
+
+    REQUIRE(1 == array1.size());
+  }
+
+  SECTION("Itself") {
+    array1.add(1);
+
+    array1.splice(array1);
+
+    REQUIRE(1 == array1.size());
+  }
+}
@@ -0,0 +1,92 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("JsonBuffer::copyCompactly()") {
+  DynamicJsonBuffer source;
+  DynamicJsonBuffer compact;
+
+  SECTION("Object") {
+    JsonObject& obj = source.parseObject(
+        "{\"a\":1,\"b\":[true,2.5,\"hello\"],\"c\":{\"d\":null},\"e\":-3}");
+    JsonObject& copy = compact.copyCompactly(obj);
+    source.clear();
+
+    REQUIRE(copy.success());
+    std::string json;
+    copy.printTo(json);
+    REQUIRE(json == "{\"a\":1,\"b\":[true,2.5,\"hello\"],\"c\":{\"d\":null},"
+                    "\"e\":-3}");
+    REQUIRE(copy["b"][2] == std::string("hello"));
+    REQUIRE(copy.get<int>("e") == -3);
+  }
+
+  SECTION("Array") {
+    JsonArray& arr = source.parseArray("[{\"id\":1},{\"id\":2}]");
+    JsonArray& copy = compact.copyCompactly(arr);
+    source.clear();
+
+    REQUIRE(copy.success());
+    REQUIRE(copy.size() == 2);
+    REQUIRE(copy[1]["id"] == 2);
+  }
+
+  SECTION("The nodes of a container are contiguous") {
+    JsonArray& arr = source.createArray();
+    for (int i = 0; i < 4; i++) {
+      arr.add(i);
+      source.createObject();  // something in between
+    }
+    JsonArray& copy = compact.copyCompactly(arr);
+
+    JsonArray::iterator it = copy.begin();
+    const char* first = reinterpret_cast<const char*>(&*it);
+    ++it;
+    const char* second = reinterpret_cast<const char*>(&*it);
+    ++it;
+    ++it;
+    const char* last = reinterpret_cast<const char*>(&*it);
+    REQUIRE(last - first == 3 * (second - first));
+    REQUIRE(compact.size() == JSON_ARRAY_SIZE(4));
+  }
+
+  SECTION("The same keys are copied once") {
+    JsonArray& arr = source.parseArray("[{\"id\":1},{\"id\":2}]");
+    JsonArray& copy = compact.copyCompactly(arr);
+
+    REQUIRE(copy[0].as<JsonObject>().begin()->key ==
+            copy[1].as<JsonObject>().begin()->key);
+  }
+
+  SECTION("Lazy values are copied") {
+    JsonArray& arr = source.parseArrayLazily("[{\"a\":[1,2]}]");
+    JsonArray& copy = compact.copyCompactly(arr);
+    source.clear();
+
+    REQUIRE(copy[0]["a"][1] == 2);
+  }
+
+  SECTION("The copy is an ordinary document") {
+    JsonObject& obj = source.parseObject("{\"a\":1}");
+    JsonObject& copy = compact.copyCompactly(obj);
+    copy["b"] = 2;
+
+    REQUIRE(copy.size() == 2);
+    REQUIRE(obj.size() == 1);
+  }
+
+  SECTION("The JsonBuffer is too small") {
+    JsonArray& arr = source.parseArray("[1,2,3]");
+    StaticJsonBuffer<JSON_ARRAY_SIZE(2)> small;
+
+    REQUIRE_FALSE(small.copyCompactly(arr).success());
+  }
+
+  SECTION("Invalid source") {
+    REQUIRE_FALSE(compact.copyCompactly(JsonObject::invalid()).success());
+    REQUIRE_FALSE(compact.copyCompactly(JsonArray::invalid()).success());
+  }
+}
@@ -0,0 +1,181 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+
+static const char* const json =
+    "{\"id\":42,\"name\":\"Joe\",\"tags\":[\"a\",\"b\",\"c\"],"
+    "\"address\":{\"city\":\"Paris\",\"zip\":75000},"
+    "\"a/b\":1,\"m~n\":2,\"\":3}";
+
+TEST_CASE("JsonBuffer::extract()") {
+  DynamicJsonBuffer jb;
+  JsonVariant values[4];
+
+  SECTION("Scalars") {
+    const char* pointers[] = {"/name", "/id"};
+
+    REQUIRE(jb.extract(json, pointers, values, 2));
+    REQUIRE(values[0] == std::string("Joe"));
+    REQUIRE(values[1] == 42);
+  }
+
+  SECTION("Nested") {
+    const char* pointers[] = {"/address/zip", "/tags/1"};
+
+    REQUIRE(jb.extract(json, pointers, values, 2));
+    REQUIRE(values[0] == 75000);
+    REQUIRE(values[1] == std::string("b"));
+  }
+
+  SECTION("Containers") {
+    const char* pointers[] = {"/tags", "/address"};
+
+    REQUIRE(jb.extract(json, pointers, values, 2));
+    REQUIRE(values[0].as<JsonArray>().size() == 3);
+    REQUIRE(values[1]["city"] == std::string("Paris"));
+  }
+
+  SECTION("Pointer inside a captured value") {
+    const char* pointers[] = {"/address", "/address/city"};
+
+    REQUIRE(jb.extract(json, pointers, values, 2));
+    REQUIRE(values[0]["zip"] == 75000);
+    REQUIRE(values[1] == std::string("Paris"));
+  }
+
+  SECTION("Whole document") {
+    const char* pointers[] = {""};
+
+    REQUIRE(jb.extract(json, pointers, values, 1));
+    REQUIRE(values[0]["id"] == 42);
+  }
+
+  SECTION("Escaped tokens") {
+    const char* pointers[] = {"/a~1b", "/m~0n", "/"};
+
+    REQUIRE(jb.extract(json, pointers, values, 3));
+    REQUIRE(values[0] == 1);
+    REQUIRE(values[1] == 2);
+    REQUIRE(values[2] == 3);
+  }
+
+  SECTION("Missing values are undefined") {
+    const char* pointers[] = {"/nope", "/tags/3", "/id/0", "/name"};
+
+    REQUIRE(jb.extract(json, pointers, values, 4));
+    REQUIRE_FALSE(values[0].success());
+    REQUIRE_FALSE(values[1].success());
+    REQUIRE_FALSE(values[2].success());
+    REQUIRE(values[3] == std::string("Joe"));
+  }
+
+  SECTION("Prefix of a key doesn't match") {
+    const char* pointers[] = {"/nam", "/names"};
+
+    REQUIRE(jb.extract(json, pointers, values, 2));
+    REQUIRE_FALSE(values[0].success());
+    REQUIRE_FALSE(values[1].success());
+  }
+
+  SECTION("Invalid pointer is ignored") {
+    const char* pointers[] = {"name", "/id"};
+
+    REQUIRE(jb.extract(json, pointers, values, 2));
+    REQUIRE_FALSE(values[0].success());
+    REQUIRE(values[1] == 42);
+  }
+
+  SECTION("Stops when all values are found") {
+    const char* pointers[] = {"/id"};
+
+    REQUIRE(jb.extract("{\"id\":1,\"garbage\":%*$", pointers, values, 1));
+    REQUIRE(values[0] == 1);
+  }
+
+  SECTION("Invalid input") {
+    const char* pointers[] = {"/b"};
+
+    REQUIRE_FALSE(jb.extract("{\"a\":1 \"b\":2}", pointers, values, 1));
+    REQUIRE_FALSE(jb.extract("{\"a\":[1,2", pointers, values, 1));
+  }
+
+  SECTION("Skipped values are not stored") {
+    const char* pointers[] = {"/id"};
+
+    REQUIRE(jb.extract("{\"skipped\":\"long string\",\"id\":1}", pointers,
+                       values, 1));
+    REQUIRE(jb.size() == sizeof("1"));  // only the value
+  }
+
+  SECTION("In place") {
+    char input[] = "{\"a\":{\"b\":[\"x\\ty\",true]}}";
+    const char* pointers[] = {"/a/b/0", "/a/b"};
+
+    REQUIRE(jb.extract(input, pointers, values, 2));
+    REQUIRE(values[0] == std::string("x\ty"));
+    REQUIRE(values[1][1] == true);
+  }
+
+  SECTION("std::string") {
+    const char* pointers[] = {"/tags/2"};
+
+    REQUIRE(jb.extract(std::string(json), pointers, values, 1));
+    REQUIRE(values[0] == std::string("c"));
+  }
+
+  SECTION("std::istream") {
+    std::istringstream input(json);
+    const char* pointers[] = {"/address/city"};
+
+    REQUIRE(jb.extract(input, pointers, values, 1));
+    REQUIRE(values[0] == std::string("Paris"));
+  }
+
+  SECTION("Array indexes") {
+    const char* pointers[] = {"/1/0", "/0/1", "/01", "/-"};
+
+    REQUIRE(jb.extract("[[1,2],[3,[4]],5]", pointers, values, 4));
+    REQUIRE(values[0] == 3);
+    REQUIRE(values[1] == 2);
+    REQUIRE_FALSE(values[2].success());  // leading zero
+    REQUIRE_FALSE(values[3].success());
+  }
+
+  SECTION("Index in a nested array doesn't match the outer one") {
+    const char* pointers[] = {"/0/2"};
+
+    REQUIRE(jb.extract("[[1],2,[5,6,7]]", pointers, values, 1));
+    REQUIRE_FALSE(values[0].success());
+  }
+
+  SECTION("Array index inside a captured value") {
+    const char* pointers[] = {"/tags", "/tags/2", "/tags/3", "/tags/x"};
+
+    REQUIRE(jb.extract(json, pointers, values, 4));
+    REQUIRE(values[1] == std::string("c"));
+    REQUIRE_FALSE(values[2].success());
+    REQUIRE_FALSE(values[3].success());
+  }
+
+  SECTION("Pointers beyond 32 are ignored") {
+    const char* pointers[33];
+    for (int i = 0; i < 33; i++) pointers[i] = "/id";
+    JsonVariant many[33];
+    many[32] = 666;
+
+    REQUIRE(jb.extract(json, pointers, many, 33));
+    REQUIRE(many[31] == 42);
+    REQUIRE_FALSE(many[32].success());
+  }
+
+  SECTION("Nesting limit") {
+    const char* pointers[] = {"/a/b"};
+
+    REQUIRE(jb.extract("{\"a\":{\"b\":1}}", pointers, values, 1, 2));
+    REQUIRE_FALSE(jb.extract("{\"a\":{\"b\":1}}", pointers, values, 1, 1));
+  }
+}
@@ -0,0 +1,125 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+#include <string>
+
+static std::string toString(JsonVariant variant) {
+  std::string result;
+  variant.printTo(result);
+  return result;
+}
+
+TEST_CASE("JsonBuffer with JsonFilter") {
+  DynamicJsonBuffer filterBuffer;
+  DynamicJsonBuffer jb;
+
+  SECTION("KeepsListedMembers") {
+    JsonObject& filter = filterBuffer.parseObject("{\"a\":true,\"c\":true}");
+    JsonObject& obj =
+        jb.parseObject("{\"a\":1,\"b\":[2,{\"x\":3}],\"c\":\"4\",\"d\":{}}",
+                       JsonFilter(filter));
+
+    REQUIRE(obj.success());
+    REQUIRE(toString(obj) == "{\"a\":1,\"c\":\"4\"}");
+  }
+
+  SECTION("NestedFilter") {
+    JsonObject& filter =
+        filterBuffer.parseObject("{\"user\":{\"id\":true},\"ok\":true}");
+    JsonObject& obj = jb.parseObject(
+        "{\"user\":{\"id\":42,\"name\":\"x\",\"tags\":[1,2]},\"ok\":true}",
+        JsonFilter(filter));
+
+    REQUIRE(toString(obj) == "{\"user\":{\"id\":42},\"ok\":true}");
+  }
+
+  SECTION("ArrayFilter") {
+    JsonObject& filter =
+        filterBuffer.parseObject("{\"items\":[{\"price\":true}]}");
+    JsonObject& obj = jb.parseObject(
+        "{\"items\":[{\"price\":1,\"name\":\"a\"},{\"price\":2,\"x\":[]}]}",
+        JsonFilter(filter));
+
+    REQUIRE(toString(obj) == "{\"items\":[{\"price\":1},{\"price\":2}]}");
+  }
+
+  SECTION("Wildcard") {
+    JsonObject& filter = filterBuffer.parseObject("{\"*\":{\"id\":true}}");
+    JsonObject& obj = jb.parseObject(
+        "{\"a\":{\"id\":1,\"x\":2},\"b\":{\"id\":3,\"y\":4}}",
+        JsonFilter(filter));
+
+    REQUIRE(toString(obj) == "{\"a\":{\"id\":1},\"b\":{\"id\":3}}");
+  }
+
+  SECTION("SkipsTrickyValues") {
+    JsonObject& filter = filterBuffer.parseObject("{\"z\":true}");
+    JsonObject& obj = jb.parseObject(
+        "{\"a\":\"]}\\\"[{\",b:[/*]*/'\\''],c:unquoted,// }\n\"z\":1}",
+        JsonFilter(filter));
+
+    REQUIRE(obj.success());
+    REQUIRE(toString(obj) == "{\"z\":1}");
+  }
+
+  SECTION("SkipsDeeperThanNestingLimit") {
+    JsonObject& filter = filterBuffer.parseObject("{\"z\":true}");
+    JsonObject& obj =
+        jb.parseObject("{\"a\":[[[[]]]],\"z\":1}", JsonFilter(filter), 2);
+
+    REQUIRE(obj.success());
+    REQUIRE(obj["z"] == 1);
+  }
+
+  SECTION("InvalidSkippedValue") {
+    JsonObject& filter = filterBuffer.parseObject("{\"z\":true}");
+    JsonObject& obj = jb.parseObject("{\"a\":[1,2", JsonFilter(filter));
+
+    REQUIRE_FALSE(obj.success());
+  }
+
+  SECTION("DoesntStoreSkippedValues") {
+    JsonObject& filter = filterBuffer.parseObject("{\"id\":true}");
+    StaticJsonBuffer<JSON_OBJECT_SIZE(1) + 16> sjb;
+    JsonObject& obj = sjb.parseObject(
+        "{\"id\":1,\"data\":[\"aaaaaaaaaaaa\",{\"b\":\"bbbbbbbbbbbb\"}]}",
+        JsonFilter(filter));
+
+    REQUIRE(obj.success());
+    REQUIRE(obj["id"] == 1);
+  }
+
+  SECTION("Stream") {
+    JsonObject& filter = filterBuffer.parseObject("{\"b\":true}");
+    std::istringstream json("{\"a\":[1,2,3],\"b\":2}");
+    JsonObject& obj = jb.parseObject(json, JsonFilter(filter));
+
+    REQUIRE(toString(obj) == "{\"b\":2}");
+  }
+
+  SECTION("parseArray") {
+    JsonArray& filter = filterBuffer.parseArray("[{\"a\":true}]");
+    JsonArray& arr =
+        jb.parseArray("[{\"a\":1,\"b\":2},{\"b\":3}]", JsonFilter(filter));
+
+    REQUIRE(toString(arr) == "[{\"a\":1},{}]");
+  }
+
+  SECTION("parse") {
+    JsonVariant var = jb.parse("{\"a\":1,\"b\":2}",
+                               JsonFilter(filterBuffer.parse("{\"b\":true}")));
+
+    REQUIRE(toString(var) == "{\"b\":2}");
+  }
+
+  SECTION("FalseSkipsEverything") {
+    JsonObject& obj = jb.parseObject("{\"a\":1}", JsonFilter(false));
+
+    REQUIRE(obj.success());
+    REQUIRE(obj.size() == 0);
+  }
+}
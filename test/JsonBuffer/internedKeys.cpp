@@ -0,0 +1,102 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+#include <string>
+
+static const char* keyOf(JsonVariant object) {
+  return object.as<JsonObject>().begin()->key;
+}
+
+TEST_CASE("Interned keys") {
+  DynamicJsonBuffer jb;
+
+  SECTION("Repeated keys are stored once") {
+    JsonArray& arr = jb.parseArray("[{\"id\":1},{\"id\":2},{\"id\":3}]");
+
+    REQUIRE(arr.success());
+    REQUIRE(keyOf(arr[0]) == keyOf(arr[1]));
+    REQUIRE(keyOf(arr[0]) == keyOf(arr[2]));
+    REQUIRE(arr[2]["id"] == 3);
+  }
+
+  SECTION("Saves memory") {
+    DynamicJsonBuffer jb1, jb2;
+    jb1.parseArray("[{\"identifier\":1},{\"identifier\":2}]");
+    jb2.parseArray("[{\"identifier\":1},{\"reifitnedi\":2}]");
+
+    REQUIRE(jb1.size() < jb2.size());
+  }
+
+  SECTION("Different keys") {
+    JsonArray& arr = jb.parseArray("[{\"a\":1},{\"ab\":2},{\"a\\u0062\":3}]");
+
+    REQUIRE(std::string(keyOf(arr[0])) == "a");
+    REQUIRE(std::string(keyOf(arr[1])) == "ab");
+    REQUIRE(keyOf(arr[1]) != keyOf(arr[0]));
+  }
+
+  SECTION("Long keys") {
+    std::string key(100, 'k');
+    std::string json = "[{\"" + key + "\":1},{\"" + key + "\":2}]";
+    JsonArray& arr = jb.parseArray(json);
+
+    REQUIRE(arr[0][key] == 1);
+    REQUIRE(arr[1][key] == 2);
+  }
+
+  SECTION("Key of 32 characters") {
+    std::string key(32, 'k');
+    std::string json = "[{\"" + key + "\":1},{\"" + key + "\":2}]";
+    JsonArray& arr = jb.parseArray(json);
+
+    REQUIRE(keyOf(arr[0]) == keyOf(arr[1]));
+    REQUIRE(arr[1][key] == 2);
+  }
+
+  SECTION("Longer key in the slot of a short key at the end of a block") {
+    // a 20-character key with the same hash as "a", modulo the number of
+    // interned keys
+    std::string key;
+    for (int i = 0;; i++) {
+      std::ostringstream candidate;
+      candidate << "k" << i;
+      key = candidate.str();
+      key.resize(20, 'x');
+      size_t hash = 0;
+      for (size_t j = 0; j < key.size(); j++)
+        hash = hash * 31 + static_cast<unsigned char>(key[j]);
+      if (hash % ARDUINOJSON_INTERNED_KEYS == 'a' % ARDUINOJSON_INTERNED_KEYS)
+        break;
+    }
+
+    // the first block ends right after "a", so the comparison must not read
+    // past its terminator
+    DynamicJsonBuffer small(JSON_ARRAY_SIZE(0) + JSON_OBJECT_SIZE(0) + 2);
+    JsonArray& arr =
+        small.parseArray("[{\"a\":1},{\"" + key + "\":2}]");
+
+    REQUIRE(arr.success());
+    REQUIRE(std::string(keyOf(arr[1])) == key);
+    REQUIRE(arr[1][key] == 2);
+  }
+
+  SECTION("std::istream") {
+    std::istringstream json("[{\"id\":1},{\"id\":2}]");
+    JsonArray& arr = jb.parseArray(json);
+
+    REQUIRE(keyOf(arr[0]) == keyOf(arr[1]));
+  }
+
+  SECTION("validateJson() takes them into account") {
+    const char* json = "[{\"id\":1,\"name\":\"a\"},{\"id\":2,\"name\":\"b\"}]";
+    size_t size = 0;
+    REQUIRE(validateJson(json, &size));
+
+    jb.parse(json);
+    REQUIRE(size == jb.size());
+  }
+}
@@ -30,6 +30,15 @@ TEST_CASE("JsonBuffer::parse()") {
     REQUIRE(variant == -42);
   }
 
+  SECTION("Integer too big for JsonUInt") {
+    JsonVariant variant = jb.parse("123456789012345678901234567890");
+    REQUIRE(variant.success());
+    REQUIRE_FALSE(variant.is<long>());
+    REQUIRE(variant.is<double>());
+    REQUIRE(variant.as<long>() == 0);
+    REQUIRE(variant.as<double>() == Approx(1.2345678901234568e+29));
+  }
+
   SECTION("Double") {
     JsonVariant variant = jb.parse("-1.23e+4");
     REQUIRE(variant.success());
@@ -180,6 +180,17 @@ TEST_CASE("JsonBuffer::parseArray()") {
     REQUIRE(arr[0] == "1\"2\\3/4\b5\f6\n7\r8\t9");
   }
 
+  SECTION("StringWithEscapedCharsInPlace") {
+    char json[] = "['hello \\'world\\'', \"it's \\\"ok\\\"\", plain]";
+    JsonArray& arr = jb.parseArray(json);
+
+    REQUIRE(arr.success());
+    REQUIRE(3 == arr.size());
+    REQUIRE(arr[0] == "hello 'world'");
+    REQUIRE(arr[1] == "it's \"ok\"");
+    REQUIRE(arr[2] == "plain");
+  }
+
   SECTION("StringWithUnterminatedEscapeSequence") {
     JsonArray& arr = jb.parseArray("\"\\\0\"", 4);
     REQUIRE_FALSE(arr.success());
@@ -285,6 +296,16 @@ TEST_CASE("JsonBuffer::parseArray()") {
     REQUIRE(arr[1] == "world");
   }
 
+  SECTION("ConsecutiveSpacesAndComments") {
+    JsonArray& arr = jb.parseArray(
+        "\r\n\t [ \n\n    /* A */ // B\n  /**/\t42 //\n,\n  43\n]  ");
+
+    REQUIRE(arr.success());
+    REQUIRE(2 == arr.size());
+    REQUIRE(arr[0] == 42);
+    REQUIRE(arr[1] == 43);
+  }
+
   SECTION("InvalidCppComment") {
     JsonArray& arr = jb.parseArray("[/COMMENT\n]");
     REQUIRE_FALSE(arr.success());
@@ -0,0 +1,58 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <string>
+
+static std::string part(const char** bounds, size_t i) {
+  return std::string(bounds[i], bounds[i + 1]);
+}
+
+TEST_CASE("splitJsonArray()") {
+  const char* bounds[4];
+
+  SECTION("Splits before the commas") {
+    const char* json = " [1,\"a,]\", [2,3] ,{\"b\":4},5,6]";
+
+    REQUIRE(splitJsonArray(json, bounds, 3));
+    REQUIRE(part(bounds, 0) == "[1,\"a,]\", [2,3] ");
+    REQUIRE(part(bounds, 1) == ",{\"b\":4}");
+    REQUIRE(part(bounds, 2) == ",5,6");
+    REQUIRE(*bounds[3] == ']');
+  }
+
+  SECTION("Fewer elements than parts") {
+    REQUIRE(splitJsonArray("[1]", bounds, 3));
+    REQUIRE(part(bounds, 0) == "[1");
+    REQUIRE(part(bounds, 1) == "");
+    REQUIRE(part(bounds, 2) == "");
+  }
+
+  SECTION("Not an array") {
+    REQUIRE_FALSE(splitJsonArray("{}", bounds, 3));
+    REQUIRE_FALSE(splitJsonArray("[1,2", bounds, 3));
+    REQUIRE_FALSE(splitJsonArray("[1 2]", bounds, 3));
+  }
+}
+
+TEST_CASE("JsonBuffer::parseArrayPart()") {
+  const char* json = "[1,\"two\",[3],{\"four\":4},5,6,7,8]";
+  const char* bounds[4];
+  REQUIRE(splitJsonArray(json, bounds, 3));
+
+  DynamicJsonBuffer rootBuffer;
+  DynamicJsonBuffer partBuffers[3];
+  JsonArray& root = rootBuffer.createArray();
+
+  for (size_t i = 0; i < 3; i++) {
+    JsonArray& part = partBuffers[i].parseArrayPart(bounds[i], bounds[i + 1]);
+    REQUIRE(part.success());
+    root.splice(part);
+  }
+
+  std::string result;
+  root.printTo(result);
+  REQUIRE(result == "[1,\"two\",[3],{\"four\":4},5,6,7,8]");
+}
@@ -0,0 +1,121 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+#include <string>
+
+static std::string toString(JsonVariant variant) {
+  std::string result;
+  variant.printTo(result);
+  return result;
+}
+
+TEST_CASE("JsonBuffer::parseObjectLazily()") {
+  DynamicJsonBuffer jb;
+
+  SECTION("TopLevelValues") {
+    JsonObject& obj = jb.parseObjectLazily("{\"a\":1,\"b\":\"x\",\"c\":true}");
+
+    REQUIRE(obj.success());
+    REQUIRE(obj["a"] == 1);
+    REQUIRE(obj["b"] == std::string("x"));
+    REQUIRE(obj["c"] == true);
+  }
+
+  SECTION("NestedValuesAreExpandedOnAccess") {
+    JsonObject& obj = jb.parseObjectLazily(
+        "{\"user\":{\"id\":42,\"tags\":[\"a\",\"b\"]},\"list\":[1,[2,3]]}");
+
+    REQUIRE(obj.success());
+    REQUIRE(obj["user"].is<JsonObject>());
+    REQUIRE(obj["list"].is<JsonArray>());
+    REQUIRE(obj["user"]["id"] == 42);
+    REQUIRE(obj["user"]["tags"][1] == std::string("b"));
+    REQUIRE(obj["list"][1][0] == 2);
+    REQUIRE(obj["list"].as<JsonArray>().size() == 2);
+  }
+
+  SECTION("SerializesUntouchedText") {
+    JsonObject& obj = jb.parseObjectLazily(
+        "{\"a\":{ \"x\" : 1 /* keep */ },\"b\":[ 1, 2 ]}");
+
+    REQUIRE(toString(obj) == "{\"a\":{ \"x\" : 1 /* keep */ },\"b\":[ 1, 2 ]}");
+  }
+
+  SECTION("SerializesModifiedValues") {
+    JsonObject& obj = jb.parseObjectLazily("{\"a\":{ \"x\" : 1 },\"b\":[ 1 ]}");
+    obj["a"]["x"] = 2;
+
+    REQUIRE(toString(obj) == "{\"a\":{\"x\":2},\"b\":[ 1 ]}");
+  }
+
+  SECTION("Iteration") {
+    JsonObject& obj = jb.parseObjectLazily("{\"a\":{\"b\":{\"c\":1}}}");
+    int count = 0;
+    for (JsonObject::iterator it = obj.begin(); it != obj.end(); ++it) {
+      JsonObject& a = it->value;
+      REQUIRE(a["b"]["c"] == 1);
+      count++;
+    }
+    REQUIRE(count == 1);
+  }
+
+  SECTION("InPlace") {
+    char json[] = "{\"a\":[\"hello\\nworld\"],\"b\":{}}";
+    JsonObject& obj = jb.parseObjectLazily(json);
+
+    REQUIRE(obj["a"][0] == std::string("hello\nworld"));
+    REQUIRE(toString(obj) == "{\"a\":[\"hello\\nworld\"],\"b\":{}}");
+  }
+
+  SECTION("Stream") {
+    std::istringstream json("{\"a\":[1,{\"b\":2}],\"c\":3}");
+    JsonObject& obj = jb.parseObjectLazily(json);
+
+    REQUIRE(obj["c"] == 3);
+    REQUIRE(obj["a"][1]["b"] == 2);
+  }
+
+  SECTION("UsesLessMemory") {
+    const char* json = "{\"a\":[1,2,3,4,5,6,7,8],\"b\":1}";
+    DynamicJsonBuffer eagerBuffer;
+    eagerBuffer.parseObject(json);
+    jb.parseObjectLazily(json);
+
+    REQUIRE(jb.size() < eagerBuffer.size());
+  }
+
+  SECTION("UnterminatedNestedValue") {
+    JsonObject& obj = jb.parseObjectLazily("{\"a\":[1,2}");
+
+    REQUIRE_FALSE(obj.success());
+  }
+
+  SECTION("InvalidNestedValueIsDetectedOnAccess") {
+    JsonObject& obj = jb.parseObjectLazily("{\"a\":[1 2],\"b\":1}");
+
+    REQUIRE(obj.success());
+    REQUIRE_FALSE(obj["a"].as<JsonArray>().success());
+    REQUIRE_FALSE(obj["a"].as<JsonArray>().success());
+  }
+
+  SECTION("NestingLimit") {
+    // same limits as parseObject(), but checked one level at a time
+    REQUIRE(jb.parseObjectLazily("{\"a\":[]}", 2).success());
+    REQUIRE_FALSE(jb.parseObjectLazily("{\"a\":[]}", 1).success());
+
+    JsonObject& obj = jb.parseObjectLazily("{\"a\":[[[]]]}", 3);
+    REQUIRE(obj["a"].as<JsonArray>().success());
+    REQUIRE_FALSE(obj["a"][0].as<JsonArray>().success());
+  }
+
+  SECTION("parseArrayLazily") {
+    JsonArray& arr = jb.parseArrayLazily("[{\"a\":1},[2]]");
+
+    REQUIRE(arr[0]["a"] == 1);
+    REQUIRE(arr[1][0] == 2);
+  }
+}
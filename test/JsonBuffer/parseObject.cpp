@@ -4,6 +4,8 @@
 
 #include <ArduinoJson.h>
 #include <catch.hpp>
+#include <stdio.h>
+#include <string>
 
 TEST_CASE("JsonBuffer::parseObject()") {
   DynamicJsonBuffer jb;
@@ -135,6 +137,58 @@ TEST_CASE("JsonBuffer::parseObject()") {
     }
   }
 
+  SECTION("Duplicate keys") {
+    SECTION("The last value wins") {
+      JsonObject& obj = jb.parseObject("{\"a\":1,\"b\":2,\"a\":3}");
+      REQUIRE(obj.success());
+      REQUIRE(obj.size() == 2);
+      REQUIRE(obj["a"] == 3);
+      REQUIRE(obj["b"] == 2);
+    }
+
+    SECTION("Same keys in nested objects") {
+      JsonObject& obj =
+          jb.parseObject("{\"a\":{\"a\":1},\"b\":{\"a\":2}}");
+      REQUIRE(obj.success());
+      REQUIRE(obj.size() == 2);
+      REQUIRE(obj["a"]["a"] == 1);
+      REQUIRE(obj["b"]["a"] == 2);
+    }
+
+    SECTION("Many keys") {
+      std::string json = "{";
+      for (int i = 0; i < 2000; i++) {
+        char key[16];
+        sprintf(key, "\"k%d\":%d,", i % 1000, i);
+        json += key;
+      }
+      json[json.size() - 1] = '}';
+
+      JsonObject& obj = jb.parseObject(json);
+      REQUIRE(obj.success());
+      REQUIRE(obj.size() == 1000);
+      REQUIRE(obj["k0"] == 1000);
+      REQUIRE(obj["k999"] == 1999);
+    }
+
+    SECTION("Many keys in a buffer of the exact size") {
+      std::string json = "{";
+      for (int i = 0; i < 80; i++) {
+        char key[16];
+        sprintf(key, "\"k%d\":%d,", i % 40, i);
+        json += key;
+      }
+      json[json.size() - 1] = '}';
+
+      StaticJsonBuffer<JSON_OBJECT_SIZE(40)> exactBuffer;
+      JsonObject& obj = exactBuffer.parseObject(&json[0]);
+      REQUIRE(obj.success());
+      REQUIRE(obj.size() == 40);
+      REQUIRE(obj["k0"] == 40);
+      REQUIRE(obj["k39"] == 79);
+    }
+  }
+
   SECTION("Misc") {
     SECTION("The opening brace is missing") {
       JsonObject& obj = jb.parseObject("}");
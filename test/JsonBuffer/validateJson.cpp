@@ -0,0 +1,105 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+#include <string>
+
+// Compares the estimate with the size used by parse()
+static void checkSize(const char* json) {
+  size_t estimate = 0;
+  REQUIRE(validateJson(json, &estimate));
+
+  DynamicJsonBuffer jb(1024);  // large enough for a single block
+  REQUIRE(jb.parse(json).success());
+  REQUIRE(estimate == jb.size());
+}
+
+static void checkSizeInPlace(const char* json) {
+  std::string copy1(json), copy2(json);
+  size_t estimate = 0;
+  REQUIRE(validateJson(&copy1[0], &estimate));
+  REQUIRE(copy1 == json);  // not modified
+
+  DynamicJsonBuffer jb(1024);
+  REQUIRE(jb.parse(&copy2[0]).success());
+  REQUIRE(estimate == jb.size());
+}
+
+TEST_CASE("validateJson()") {
+  SECTION("Valid") {
+    REQUIRE(validateJson("[1,{\"a\":true}]"));
+    REQUIRE(validateJson(std::string("{}")));
+  }
+
+  SECTION("Invalid") {
+    REQUIRE_FALSE(validateJson("[1,2"));
+    REQUIRE_FALSE(validateJson("{\"a\" 1}"));
+    REQUIRE_FALSE(validateJson("[1 2]"));
+  }
+
+  SECTION("Nesting limit") {
+    REQUIRE(validateJson("[[1]]", NULL, 2));
+    REQUIRE_FALSE(validateJson("[[1]]", NULL, 1));
+  }
+
+  SECTION("Doesn't touch bufferSize on failure") {
+    size_t size = 42;
+    REQUIRE_FALSE(validateJson("[", &size));
+    REQUIRE(size == 42);
+  }
+
+  SECTION("Size") {
+    checkSize("[]");
+    checkSize("{}");
+    checkSize("[1,2,3]");
+    checkSize("{\"a\":1,\"bb\":\"hello\",\"ccc\":[true,null]}");
+    checkSize("[\"a\",\"bc\",\"def\",{\"g\":\"h\\ni\"},[[],{}]]");
+    checkSize("[ 'single' , unquoted , 1.5e3 ]");
+    checkSize("\"just a string\"");
+    checkSize("[1234567890123456789012345678901234567890,-1]");
+  }
+
+  SECTION("Size in place") {
+    checkSizeInPlace("[]");
+    checkSizeInPlace("{\"a\":1,\"bb\":\"hello\",\"ccc\":[true,null]}");
+    checkSizeInPlace("[\"a\",\"bc\",{\"g\":\"h\\ni\"},[[],{}]]");
+  }
+
+  SECTION("Size of big objects") {
+    std::ostringstream json;
+    json << "{\"nested\":{";
+    for (int i = 0; i < 100; i++)
+      json << (i ? "," : "") << "\"n" << i << "\":0";
+    json << "}";
+    for (int i = 0; i < 1000; i++) json << ",\"k" << i << "\":" << i;
+    json << "}";
+
+    size_t estimate = 0;
+    REQUIRE(validateJson(json.str(), &estimate));
+
+    DynamicJsonBuffer jb(estimate);  // a single block
+    REQUIRE(jb.parse(json.str()).success());
+    REQUIRE(estimate == jb.size());
+  }
+
+  SECTION("std::istream") {
+    std::istringstream json("[\"abc\",{\"d\":1}]");
+    size_t size = 0, expected = 0;
+    REQUIRE(validateJson(json, &size));
+    REQUIRE(validateJson("[\"abc\",{\"d\":1}]", &expected));
+    REQUIRE(size == expected);
+  }
+
+  SECTION("Fits exactly in a StaticJsonBuffer") {
+    const char* json = "[\"abc\",{\"d\":1}]";
+    size_t size = 0;
+    REQUIRE(validateJson(json, &size));
+
+    StaticJsonBuffer<1024> big;
+    REQUIRE(big.parse(json).success());
+    REQUIRE(big.size() == size);
+  }
+}
@@ -0,0 +1,229 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+#include <string>
+
+// Records the events in a string
+struct Recorder : JsonEventHandler {
+  std::string events;
+
+  bool onStartObject() {
+    events += "{";
+    return true;
+  }
+  bool onEndObject() {
+    events += "}";
+    return true;
+  }
+  bool onStartArray() {
+    events += "[";
+    return true;
+  }
+  bool onEndArray() {
+    events += "]";
+    return true;
+  }
+  bool onKey(const char* s, size_t n) {
+    events += "K(" + std::string(s, n) + ")";
+    return true;
+  }
+  bool onString(const char* s, size_t n) {
+    events += "S(" + std::string(s, n) + ")";
+    return true;
+  }
+  bool onKeyPart(const char* s, size_t n) {
+    events += "k(" + std::string(s, n) + ")";
+    return true;
+  }
+  bool onStringPart(const char* s, size_t n) {
+    events += "s(" + std::string(s, n) + ")";
+    return true;
+  }
+  bool onNumber(const char* s, size_t n) {
+    events += "N(" + std::string(s, n) + ")";
+    return true;
+  }
+  bool onBool(bool b) {
+    events += b ? "true" : "false";
+    return true;
+  }
+  bool onNull() {
+    events += "null";
+    return true;
+  }
+};
+
+// Only counts the keys, the other events use the default handler
+struct KeyCounter : JsonEventHandler {
+  int keys;
+  KeyCounter() : keys(0) {}
+
+  bool onKey(const char*, size_t) {
+    keys++;
+    return true;
+  }
+};
+
+// Puts the pieces of the strings back together
+struct Assembler : JsonEventHandler {
+  std::string pending;
+  std::string key;
+  std::string value;
+
+  bool onKeyPart(const char* s, size_t n) {
+    pending.append(s, n);
+    return true;
+  }
+  bool onKey(const char* s, size_t n) {
+    key = pending + std::string(s, n);
+    pending.clear();
+    return true;
+  }
+  bool onStringPart(const char* s, size_t n) {
+    pending.append(s, n);
+    return true;
+  }
+  bool onString(const char* s, size_t n) {
+    value = pending + std::string(s, n);
+    pending.clear();
+    return true;
+  }
+};
+
+// Doesn't want the long strings
+struct ShortStringsOnly : JsonEventHandler {
+  bool onStringPart(const char*, size_t) {
+    return false;
+  }
+};
+
+// Stops after the first string
+struct FirstString : JsonEventHandler {
+  std::string value;
+
+  bool onString(const char* s, size_t n) {
+    value.assign(s, n);
+    return false;
+  }
+};
+
+TEST_CASE("parseJsonEvents()") {
+  Recorder recorder;
+
+  SECTION("Object") {
+    REQUIRE(parseJsonEvents("{\"a\":1,'b':[true,false,null],c:\"x\"}",
+                            recorder));
+    REQUIRE(recorder.events == "{K(a)N(1)K(b)[truefalsenull]K(c)S(x)}");
+  }
+
+  SECTION("NumbersAreNotConverted") {
+    REQUIRE(parseJsonEvents("[-12,3.5e+7,NaN]", recorder));
+    REQUIRE(recorder.events == "[N(-12)N(3.5e+7)N(NaN)]");
+  }
+
+  SECTION("NonQuotedString") {
+    REQUIRE(parseJsonEvents("[hello,]", recorder));
+    REQUIRE(recorder.events == "[S(hello)S()]");
+  }
+
+  SECTION("EscapedChars") {
+    REQUIRE(parseJsonEvents("[\"1\\\"2\\\\3\\n4\"]", recorder));
+    REQUIRE(recorder.events == "[S(1\"2\\3\n4)]");
+  }
+
+  SECTION("SpacesAndComments") {
+    REQUIRE(parseJsonEvents(" /**/ { // c\n a : [ 1 , 2 ] } ", recorder));
+    REQUIRE(recorder.events == "{K(a)[N(1)N(2)]}");
+  }
+
+  SECTION("InPlace") {
+    char json[] = "{\"a\\tb\":[\"c\"]}";
+    REQUIRE(parseJsonEvents(json, recorder));
+    REQUIRE(recorder.events == "{K(a\tb)[S(c)]}");
+  }
+
+  SECTION("std::string") {
+    REQUIRE(parseJsonEvents(std::string("{\"a\":[]}"), recorder));
+    REQUIRE(recorder.events == "{K(a)[]}");
+  }
+
+  SECTION("std::istream") {
+    std::istringstream json("{\"a\":[]}");
+    REQUIRE(parseJsonEvents(json, recorder));
+    REQUIRE(recorder.events == "{K(a)[]}");
+  }
+
+  SECTION("InvalidInput") {
+    REQUIRE_FALSE(parseJsonEvents("[1 2]", recorder));
+    REQUIRE_FALSE(parseJsonEvents("{\"a\" 1}", recorder));
+    REQUIRE_FALSE(parseJsonEvents("[1", recorder));
+  }
+
+  SECTION("NestingLimit") {
+    REQUIRE(parseJsonEvents("[[]]", recorder, 2));
+    REQUIRE_FALSE(parseJsonEvents("[[[]]]", recorder, 2));
+  }
+
+  SECTION("LongString") {
+    const size_t size = ARDUINOJSON_EVENT_STRING_SIZE;
+    std::string longKey(size, 'k');
+    std::string longValue = std::string(size, 'x') + "\\n" +
+                            std::string(3 * size, 'y');
+    std::string expectedValue = std::string(size, 'x') + "\n" +
+                                std::string(3 * size, 'y');
+    std::string json = "{\"" + longKey + "\":\"" + longValue + "\"}";
+    Assembler assembler;
+
+    SECTION("std::string") {
+      REQUIRE(parseJsonEvents(json, assembler));
+      REQUIRE(assembler.key == longKey);
+      REQUIRE(assembler.value == expectedValue);
+    }
+
+    SECTION("std::istream") {
+      std::istringstream stream(json);
+      REQUIRE(parseJsonEvents(stream, assembler));
+      REQUIRE(assembler.key == longKey);
+      REQUIRE(assembler.value == expectedValue);
+    }
+
+    SECTION("The span of the input is passed as is") {
+      std::string span(size, 'x');
+      REQUIRE(parseJsonEvents("[\"" + span + "\"]", recorder));
+      REQUIRE(recorder.events == "[s(" + span + ")S()]");
+    }
+
+    SECTION("Without quotes") {
+      std::string digits(size, '1');
+      REQUIRE(parseJsonEvents("[" + digits + "]", recorder));
+      REQUIRE(recorder.events == "[s(" + digits + ")S()]");
+    }
+
+    SECTION("The pieces are skipped by default") {
+      KeyCounter counter;
+      REQUIRE(parseJsonEvents(json, counter));
+      REQUIRE(counter.keys == 1);
+    }
+
+    SECTION("The handler stops the parsing") {
+      ShortStringsOnly handler;
+      REQUIRE_FALSE(parseJsonEvents(json, handler));
+    }
+  }
+
+  SECTION("PartialHandler") {
+    KeyCounter counter;
+    REQUIRE(parseJsonEvents("[{\"a\":1},{\"b\":{\"c\":2}}]", counter));
+    REQUIRE(counter.keys == 3);
+  }
+
+  SECTION("HandlerStopsParsing") {
+    FirstString handler;
+    REQUIRE_FALSE(parseJsonEvents("[\"a\",\"b\"", handler));
+    REQUIRE(handler.value == "a");
+  }
+}
@@ -0,0 +1,114 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+
+template <typename TReader>
+static std::string readAll(TReader& reader) {
+  std::string result;
+  while (reader.next()) {
+    if (reader.success())
+      reader.document().printTo(result);
+    else
+      result += "!";
+    result += "|";
+  }
+  return result;
+}
+
+TEST_CASE("JsonLinesReader") {
+  DynamicJsonBuffer jb;
+
+  SECTION("char*") {
+    char input[] = "{\"a\":1}\n[\"b\\n\"]\n42";
+    JsonLinesReader<DynamicJsonBuffer, char*> reader(jb, input);
+
+    REQUIRE(readAll(reader) == "{\"a\":1}|[\"b\\n\"]|42|");
+    REQUIRE(reader.count() == 3);
+  }
+
+  SECTION("const char*") {
+    JsonLinesReader<DynamicJsonBuffer, const char*> reader(jb, "[1]\n[2]\n");
+
+    REQUIRE(readAll(reader) == "[1]|[2]|");
+  }
+
+  SECTION("Range that is not null-terminated") {
+    char input[] = "[1]\n[2]XXX";
+    JsonLinesReader<DynamicJsonBuffer, char*> reader(jb, input, input + 7);
+
+    REQUIRE(readAll(reader) == "[1]|[2]|");
+  }
+
+  SECTION("std::istream") {
+    std::istringstream input("[1]\r\n{\"b\":2}\r\n");
+    JsonLinesReader<DynamicJsonBuffer, std::istream&> reader(jb, input);
+
+    REQUIRE(readAll(reader) == "[1]|{\"b\":2}|");
+  }
+
+  SECTION("Empty input") {
+    JsonLinesReader<DynamicJsonBuffer, const char*> reader(jb, "");
+
+    REQUIRE_FALSE(reader.next());
+    REQUIRE(reader.count() == 0);
+  }
+
+  SECTION("Skips empty lines") {
+    char input[] = "\n[1]\n\n  \n[2]\n\n";
+    JsonLinesReader<DynamicJsonBuffer, char*> reader(jb, input);
+
+    REQUIRE(readAll(reader) == "[1]|[2]|");
+    REQUIRE(reader.count() == 2);
+  }
+
+  SECTION("Reports invalid records and continues") {
+    char input[] = "[1]\n[2\n{\"a\":3}";
+    JsonLinesReader<DynamicJsonBuffer, char*> reader(jb, input);
+
+    REQUIRE(reader.next());
+    REQUIRE(reader.success());
+    REQUIRE(reader.next());
+    REQUIRE_FALSE(reader.success());
+    REQUIRE_FALSE(reader.document().success());
+    REQUIRE(reader.count() == 2);
+    REQUIRE(reader.next());
+    REQUIRE(reader.document()["a"] == 3);
+    REQUIRE_FALSE(reader.next());
+  }
+
+  SECTION("JSON text sequence") {
+    const char* input = "\x1E{\"a\":\n1}\n\x1E[2,\n3]\n";
+
+    SECTION("const char*") {
+      JsonLinesReader<DynamicJsonBuffer, const char*> reader(jb, input);
+      REQUIRE(readAll(reader) == "{\"a\":1}|[2,3]|");
+    }
+
+    SECTION("std::istream") {
+      std::istringstream stream(input);
+      JsonLinesReader<DynamicJsonBuffer, std::istream&> reader(jb, stream);
+      REQUIRE(readAll(reader) == "{\"a\":1}|[2,3]|");
+    }
+  }
+
+  SECTION("StaticJsonBuffer") {
+    StaticJsonBuffer<JSON_ARRAY_SIZE(3)> sjb;
+    JsonLinesReader<StaticJsonBuffer<JSON_ARRAY_SIZE(3)>, const char*> reader(
+        sjb, "[1,2,3]\n[1,2,3,4]\n[4,5,6]");
+
+    REQUIRE(readAll(reader) == "!|!|!|");  // no room for the copies
+  }
+
+  SECTION("StaticJsonBuffer in place") {
+    StaticJsonBuffer<JSON_ARRAY_SIZE(3)> sjb;
+    char input[] = "[1,2,3]\n[1,2,3,4]\n[4,5,6]\n";
+    JsonLinesReader<StaticJsonBuffer<JSON_ARRAY_SIZE(3)>, char*> reader(
+        sjb, input);
+
+    REQUIRE(readAll(reader) == "[1,2,3]|!|[4,5,6]|");
+  }
+}
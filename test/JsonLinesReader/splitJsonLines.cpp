@@ -0,0 +1,56 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <string>
+
+static std::string part(const char** bounds, size_t i) {
+  return std::string(bounds[i], bounds[i + 1]);
+}
+
+TEST_CASE("splitJsonLines()") {
+  SECTION("Splits after the newlines") {
+    const char* input = "[1]\n[22]\n[333]\n[4444]\n";
+    const char* bounds[3];
+    splitJsonLines(input, input + strlen(input), bounds, 2);
+
+    REQUIRE(part(bounds, 0) == "[1]\n[22]\n[333]\n");
+    REQUIRE(part(bounds, 1) == "[4444]\n");
+  }
+
+  SECTION("Splits before the RS of a JSON text sequence") {
+    const char* input = "\x1E[1,\n2]\n\x1E[3]\n";
+    const char* bounds[3];
+    splitJsonLines(input, input + strlen(input), bounds, 2);
+
+    REQUIRE(part(bounds, 0) == "\x1E[1,\n2]\n");
+    REQUIRE(part(bounds, 1) == "\x1E[3]\n");
+  }
+
+  SECTION("Part is empty when a record is too big") {
+    const char* input = "[1,2,3,4,5,6,7,8,9]\n[1]";
+    const char* bounds[4];
+    splitJsonLines(input, input + strlen(input), bounds, 3);
+
+    REQUIRE(part(bounds, 0) == "[1,2,3,4,5,6,7,8,9]\n");
+    REQUIRE(part(bounds, 1) == "[1]");
+    REQUIRE(part(bounds, 2) == "");
+  }
+
+  SECTION("Each part can be read separately") {
+    char input[] = "[1]\n[2]\n[3]\n[4]\n[5]\n[6]\n";
+    char* bounds[4];
+    splitJsonLines(input, input + strlen(input), bounds, 3);
+
+    int expected = 1;
+    for (size_t i = 0; i < 3; i++) {
+      DynamicJsonBuffer jb;
+      JsonLinesReader<DynamicJsonBuffer, char*> reader(jb, bounds[i],
+                                                       bounds[i + 1]);
+      while (reader.next()) REQUIRE(reader.document()[0] == expected++);
+    }
+    REQUIRE(expected == 7);
+  }
+}
@@ -94,6 +94,15 @@ TEST_CASE("JsonObject::set()") {
     REQUIRE(false == obj.set(std::string("hello"), std::string("world")));
   }
 
+  SECTION("doesn't add a pair when the key can't be copied") {
+    StaticJsonBuffer<JSON_OBJECT_SIZE(1) + 3> jsonBuffer;
+    JsonObject& obj = jsonBuffer.createObject();
+
+    REQUIRE(false == obj.set(std::string("hello"), 1));
+    REQUIRE(0 == obj.size());
+    REQUIRE(obj.begin() == obj.end());
+  }
+
   SECTION("should not duplicate const char*") {
     _object.set("hello", "world");
     const size_t expectedSize = JSON_OBJECT_SIZE(1);
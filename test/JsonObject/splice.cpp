@@ -0,0 +1,41 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("JsonObject::splice()") {
+  DynamicJsonBuffer jb1, jb2;
+  JsonObject& obj1 = jb1.createObject();
+  JsonObject& obj2 = jb2.createObject();
+
+  SECTION("Moves the pairs at the end") {
+    obj1["a"] = 1;
+    obj2["b"] = 2;
+    obj2["c"] = 3;
+
+    obj1.splice(obj2);
+
+    REQUIRE(3 == obj1.size());
+    REQUIRE(obj1["c"] == 3);
+    REQUIRE(0 == obj2.size());
+  }
+
+  SECTION("To an invalid object") {
+    obj2["a"] = 1;
+
+    JsonObject::invalid().splice(obj2);
+
+    REQUIRE(0 == JsonObject::invalid().size());
+    REQUIRE(1 == obj2.size());
+  }
+
+  SECTION("From an invalid object") {
+    obj1["a"] = 1;
+
+    obj1.splice(JsonObject::invalid());
+
+    REQUIRE(1 == obj1.size());
+  }
+}
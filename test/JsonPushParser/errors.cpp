@@ -0,0 +1,86 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+typedef JsonPushParser<DynamicJsonBuffer> Parser;
+
+static Parser::Status parse(const char* json) {
+  DynamicJsonBuffer jb;
+  Parser parser(jb);
+  Parser::Status status = parser.feed(json);
+  if (status == Parser::NEED_MORE) status = parser.finish();
+  return status;
+}
+
+TEST_CASE("JsonPushParser errors") {
+  SECTION("EmptyInput") {
+    REQUIRE(parse("") == Parser::INVALID_INPUT);
+  }
+
+  SECTION("Garbage") {
+    REQUIRE(parse("%*$") == Parser::INVALID_INPUT);
+  }
+
+  SECTION("MissingClosingBracket") {
+    REQUIRE(parse("[1,2") == Parser::INVALID_INPUT);
+  }
+
+  SECTION("MissingComma") {
+    REQUIRE(parse("[1 2]") == Parser::INVALID_INPUT);
+  }
+
+  SECTION("MissingColon") {
+    REQUIRE(parse("{\"a\" 1}") == Parser::INVALID_INPUT);
+  }
+
+  SECTION("MismatchedBrackets") {
+    REQUIRE(parse("[1}") == Parser::INVALID_INPUT);
+    REQUIRE(parse("{\"a\":1]") == Parser::INVALID_INPUT);
+  }
+
+  SECTION("ClosingQuoteMissing") {
+    REQUIRE(parse("\"hello") == Parser::INVALID_INPUT);
+  }
+
+  SECTION("NulInString") {
+    DynamicJsonBuffer jb;
+    Parser parser(jb);
+    REQUIRE(parser.feed("[\"a\0b\"]", 7) == Parser::INVALID_INPUT);
+  }
+
+  SECTION("UnterminatedComment") {
+    REQUIRE(parse("[/* 1]") == Parser::INVALID_INPUT);
+  }
+
+  SECTION("InvalidComment") {
+    REQUIRE(parse("[/1]") == Parser::INVALID_INPUT);
+  }
+
+  SECTION("TooDeep") {
+    DynamicJsonBuffer jb;
+    JsonPushParser<DynamicJsonBuffer, 2> parser(jb);
+    REQUIRE(parser.feed("[[") == Parser::NEED_MORE);
+    REQUIRE(parser.feed("[") == Parser::TOO_DEEP);
+  }
+
+  SECTION("NotTooDeep") {
+    DynamicJsonBuffer jb;
+    JsonPushParser<DynamicJsonBuffer, 2> parser(jb);
+    REQUIRE(parser.feed("[[]]") == Parser::DONE);
+  }
+
+  SECTION("NoMemoryForContainer") {
+    StaticJsonBuffer<JSON_ARRAY_SIZE(0)> jb;
+    JsonPushParser<StaticJsonBuffer<JSON_ARRAY_SIZE(0)> > parser(jb);
+    REQUIRE(parser.feed("[[") == Parser::NO_MEMORY);
+  }
+
+  SECTION("NoMemoryForString") {
+    StaticJsonBuffer<JSON_ARRAY_SIZE(1) + 3> jb;
+    JsonPushParser<StaticJsonBuffer<JSON_ARRAY_SIZE(1) + 3> > parser(jb);
+    REQUIRE(parser.feed("[\"hello\"]") == Parser::NO_MEMORY);
+  }
+}
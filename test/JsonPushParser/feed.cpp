@@ -0,0 +1,140 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <string>
+
+typedef JsonPushParser<DynamicJsonBuffer> Parser;
+
+static std::string toString(JsonVariant variant) {
+  std::string result;
+  variant.printTo(result);
+  return result;
+}
+
+// Feeds the input in chunks of the specified size and compares the result
+// with JsonBuffer::parse()
+static void checkChunks(const char* json, size_t chunkSize) {
+  DynamicJsonBuffer expectedBuffer;
+  std::string expected = toString(expectedBuffer.parse(json));
+
+  DynamicJsonBuffer jb;
+  Parser parser(jb);
+  size_t length = strlen(json);
+  Parser::Status status = Parser::NEED_MORE;
+  for (size_t i = 0; i < length && status == Parser::NEED_MORE;
+       i += chunkSize) {
+    size_t n = length - i < chunkSize ? length - i : chunkSize;
+    status = parser.feed(json + i, n);
+  }
+  if (status == Parser::NEED_MORE) status = parser.finish();
+
+  REQUIRE(status == Parser::DONE);
+  REQUIRE(toString(parser.result()) == expected);
+}
+
+static void check(const char* json) {
+  for (size_t chunkSize = 1; chunkSize <= strlen(json); chunkSize++)
+    checkChunks(json, chunkSize);
+}
+
+TEST_CASE("JsonPushParser::feed()") {
+  SECTION("EmptyArray") {
+    check("[]");
+  }
+
+  SECTION("EmptyObject") {
+    check("{}");
+  }
+
+  SECTION("Values") {
+    check("[42,-1.5e3,true,false,null,\"hello\",'world',unquoted]");
+  }
+
+  SECTION("EscapedChars") {
+    check("[\"1\\\"2\\\\3\\/4\\b5\\f6\\n7\\r8\\t9\",'\\'']");
+  }
+
+  SECTION("NestedObjects") {
+    check("{\"a\":{\"b\":[1,{\"c\":[]}]},\"d\":{}}");
+  }
+
+  SECTION("NonQuotedKeys") {
+    check("{a:1,b:hello}");
+  }
+
+  SECTION("SpacesAndComments") {
+    check(
+        " /* A */ [ // B\n 1 /**/ , /***/ 2 //\n , { 'a' /* * */ : 3 } ] ");
+  }
+
+  SECTION("EmptyValues") {
+    check("[,]");
+  }
+
+  SECTION("RootString") {
+    check("\"hello\"");
+  }
+
+  SECTION("RootNumber") {
+    check("42");
+    check("-3.14");
+  }
+
+  SECTION("RootNumberFollowedBySpace") {
+    DynamicJsonBuffer jb;
+    Parser parser(jb);
+
+    REQUIRE(parser.feed("4") == Parser::NEED_MORE);
+    REQUIRE(parser.feed("2 ") == Parser::DONE);
+    REQUIRE(parser.result() == 42);
+  }
+
+  SECTION("IgnoresTrailingCharacters") {
+    DynamicJsonBuffer jb;
+    Parser parser(jb);
+
+    REQUIRE(parser.feed("[1]]") == Parser::DONE);
+    REQUIRE(parser.feed("garbage") == Parser::DONE);
+    REQUIRE(parser.result()[0] == 1);
+  }
+
+  SECTION("ResultIsUndefinedUntilDone") {
+    DynamicJsonBuffer jb;
+    Parser parser(jb);
+
+    REQUIRE(parser.feed("[1") == Parser::NEED_MORE);
+    REQUIRE_FALSE(parser.result().success());
+  }
+
+  SECTION("StringsAreCopied") {
+    DynamicJsonBuffer jb;
+    Parser parser(jb);
+    char chunk[8];
+
+    strcpy(chunk, "{\"he");
+    parser.feed(chunk);
+    strcpy(chunk, "llo\":");
+    parser.feed(chunk);
+    strcpy(chunk, "'wor");
+    parser.feed(chunk);
+    strcpy(chunk, "ld'}");
+    REQUIRE(parser.feed(chunk) == Parser::DONE);
+    strcpy(chunk, "XXXXXXX");
+
+    REQUIRE(parser.result()["hello"] == std::string("world"));
+  }
+
+  SECTION("StaticJsonBuffer") {
+    StaticJsonBuffer<200> jb;
+    JsonPushParser<StaticJsonBuffer<200> > parser(jb);
+
+    parser.feed("{\"key\"");
+    parser.feed(":[1,");
+
+    REQUIRE(parser.feed("2]}") == Parser::DONE);
+    REQUIRE(parser.result()["key"][1] == 2);
+  }
+}
@@ -0,0 +1,55 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <string>
+
+static std::string nestedArrays(size_t depth) {
+  return std::string(depth, '[') + "42" + std::string(depth, ']');
+}
+
+TEST_CASE("parseIteratively()") {
+  DynamicJsonBuffer jb;
+
+  SECTION("Object") {
+    JsonVariant root = parseIteratively<10>(jb, "{\"a\":[1,{\"b\":2}]}");
+
+    REQUIRE(root["a"][1]["b"] == 2);
+  }
+
+  SECTION("Number") {
+    JsonVariant root = parseIteratively<10>(jb, "42");
+
+    REQUIRE(root == 42);
+  }
+
+  SECTION("Invalid input") {
+    JsonVariant root = parseIteratively<10>(jb, "[1,2");
+
+    REQUIRE_FALSE(root.success());
+  }
+
+  SECTION("More than 255 levels") {
+    std::string json = nestedArrays(1000);
+    JsonVariant root = parseIteratively<1000>(jb, json.c_str());
+
+    REQUIRE(root.success());
+    for (int i = 0; i < 1000; i++) root = root[0];
+    REQUIRE(root == 42);
+  }
+
+  SECTION("Too deep") {
+    std::string json = nestedArrays(1001);
+    JsonVariant root = parseIteratively<1000>(jb, json.c_str());
+
+    REQUIRE_FALSE(root.success());
+  }
+
+  SECTION("Length") {
+    JsonVariant root = parseIteratively<10>(jb, "[1][2]", 3);
+
+    REQUIRE(root[0] == 1);
+  }
+}
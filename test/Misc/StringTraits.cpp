@@ -4,6 +4,7 @@
 
 #include <ArduinoJson.h>
 #include <catch.hpp>
+#include <sstream>
 
 using namespace ArduinoJson::Internals;
 
@@ -12,6 +13,11 @@ bool should_duplicate() {
   return StringTraits<String>::should_duplicate;
 }
 
+template <typename String>
+bool is_contiguous() {
+  return IsContiguousReader<typename StringTraits<String>::Reader>::value;
+}
+
 TEST_CASE("StringTraits") {
   SECTION("should_duplicate") {
     REQUIRE(false == should_duplicate<const char*>());
@@ -19,4 +25,12 @@ TEST_CASE("StringTraits") {
     REQUIRE(true == should_duplicate<RawJsonString<char*> >());
     REQUIRE(false == should_duplicate<RawJsonString<const char*> >());
   }
+
+  SECTION("is_contiguous") {
+    REQUIRE(true == is_contiguous<const char*>());
+    REQUIRE(true == is_contiguous<char*>());
+    REQUIRE(true == is_contiguous<unsigned char*>());
+    REQUIRE(true == is_contiguous<std::string>());
+    REQUIRE(false == is_contiguous<std::istream>());
+  }
 }
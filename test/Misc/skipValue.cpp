@@ -0,0 +1,87 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+#include <string>
+
+using namespace ArduinoJson::Internals;
+
+// Returns the skipped span, or "NULL"
+static std::string skipInRam(const char* json) {
+  const char* begin = skipSpacesAndComments(json);
+  const char* end = skipValue(json);
+  if (!end) return "NULL";
+  return std::string(begin, end);
+}
+
+// Returns what's left after the value, or "NULL"
+static std::string skipInStream(const char* json) {
+  std::istringstream stream(json);
+  StringTraits<std::istream>::Reader reader(stream);
+  if (!skipValue(reader)) return "NULL";
+  std::string rest;
+  while (reader.current()) {
+    rest += reader.current();
+    reader.move();
+  }
+  return rest;
+}
+
+static void check(const char* json, const char* expectedSpan) {
+  REQUIRE(skipInRam(json) == expectedSpan);
+  if (strcmp(expectedSpan, "NULL") == 0) {
+    REQUIRE(skipInStream(json) == "NULL");
+  } else {
+    const char* rest = skipValue(json);
+    REQUIRE(skipInStream(json) == rest);
+  }
+}
+
+TEST_CASE("skipValue()") {
+  SECTION("Number") {
+    check(" 42,", "42");
+  }
+
+  SECTION("Literal") {
+    check("true}", "true");
+  }
+
+  SECTION("EmptyValue") {
+    check(",", "");
+  }
+
+  SECTION("String") {
+    check("\"a\\\"b\\\\\",1", "\"a\\\"b\\\\\"");
+    check("'a\"b',1", "'a\"b'");
+  }
+
+  SECTION("UnterminatedString") {
+    check("\"abc", "NULL");
+    check("\"abc\\", "NULL");
+  }
+
+  SECTION("Array") {
+    check("[1,[2,[3]],\"]\"]]", "[1,[2,[3]],\"]\"]");
+  }
+
+  SECTION("Object") {
+    check("{'a':{'}':[{}]},b:2},3", "{'a':{'}':[{}]},b:2}");
+  }
+
+  SECTION("Comments") {
+    check("/*[*/ [1, /* ] */ 2 // ]\n, 3/4]x", "[1, /* ] */ 2 // ]\n, 3/4]");
+  }
+
+  SECTION("UnterminatedArray") {
+    check("[1,[2]", "NULL");
+    check("[1, /* ] */", "NULL");
+  }
+
+  SECTION("DeeplyNested") {
+    std::string json = std::string(1000, '[') + std::string(1000, ']');
+    check(json.c_str(), json.c_str());
+  }
+}
@@ -81,4 +81,20 @@ TEST_CASE("std::stream") {
     jsonBuffer.parseObject(json);
     REQUIRE('1' == json.get());
   }
+
+  SECTION("SetsEofWhenReachingTheEnd") {
+    std::istringstream json("[1,2");
+    DynamicJsonBuffer jsonBuffer;
+    REQUIRE_FALSE(jsonBuffer.parseArray(json).success());
+    REQUIRE(json.eof());
+  }
+
+  SECTION("ParseLongString") {
+    std::string value(1000, 'x');
+    std::istringstream json("[\"" + value + "\"]");
+    DynamicJsonBuffer jsonBuffer;
+    JsonArray& arr = jsonBuffer.parseArray(json);
+    REQUIRE(arr.success());
+    REQUIRE(value == arr[0].as<std::string>());
+  }
 }
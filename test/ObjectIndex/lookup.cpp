@@ -0,0 +1,125 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#define ARDUINOJSON_OBJECT_INDEX_THRESHOLD 4
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <stdio.h>
+#include <string>
+
+static std::string keyOf(int i) {
+  char key[16];
+  sprintf(key, "key%d", i);
+  return key;
+}
+
+TEST_CASE("ARDUINOJSON_OBJECT_INDEX_THRESHOLD") {
+  DynamicJsonBuffer jb;
+  JsonObject& obj = jb.createObject();
+  for (int i = 0; i < 100; i++) obj[keyOf(i)] = i;
+
+  SECTION("finds every key") {
+    for (int i = 0; i < 100; i++) REQUIRE(obj[keyOf(i)] == i);
+    REQUIRE_FALSE(obj.containsKey("key100"));
+    REQUIRE_FALSE(obj.containsKey(""));
+  }
+
+  SECTION("set() replaces the value") {
+    obj["key42"] = "hello";
+    REQUIRE(obj.size() == 100);
+    REQUIRE(obj["key42"] == "hello");
+  }
+
+  SECTION("keeps the order of the keys") {
+    int i = 0;
+    for (JsonObject::iterator it = obj.begin(); it != obj.end(); ++it, ++i)
+      REQUIRE(keyOf(i) == it->key);
+    REQUIRE(i == 100);
+  }
+
+  SECTION("remove() by key") {
+    for (int i = 0; i < 100; i += 2) obj.remove(keyOf(i));
+    REQUIRE(obj.size() == 50);
+    for (int i = 0; i < 100; i++)
+      REQUIRE(obj.containsKey(keyOf(i)) == (i % 2 == 1));
+  }
+
+  SECTION("remove() by iterator, then add") {
+    obj.remove(obj.begin());
+    JsonObject::iterator last = obj.begin();
+    last += 98;
+    obj.remove(last);
+    obj["key0"] = 1000;
+    obj["key99"] = 1099;
+
+    REQUIRE(obj.size() == 100);
+    REQUIRE(obj["key0"] == 1000);
+    REQUIRE(obj["key1"] == 1);
+    REQUIRE(obj["key99"] == 1099);
+  }
+
+  SECTION("splice() resets the index of the other object") {
+    REQUIRE(obj["key99"] == 99);
+    JsonObject& receiver = jb.createObject();
+    receiver.splice(obj);
+    receiver["added"] = 1;
+    JsonObject& other = jb.createObject();
+    for (int i = 0; i < 120; i++) other[keyOf(1000 + i)] = i;
+    obj.splice(other);
+
+    REQUIRE(obj.size() == 120);
+    REQUIRE_FALSE(obj.containsKey("key0"));
+    REQUIRE_FALSE(obj.containsKey("added"));
+    REQUIRE(obj["key1119"] == 119);
+    REQUIRE(receiver["key0"] == 0);
+    REQUIRE(receiver["added"] == 1);
+  }
+
+  SECTION("splice() keeps the index of this object") {
+    REQUIRE(obj["key99"] == 99);
+    JsonObject& other = jb.createObject();
+    other["key0"] = -1;
+    other["spliced"] = 1;
+    obj.splice(other);
+
+    REQUIRE(obj.size() == 102);
+    REQUIRE(obj["key0"] == 0);  // the first pair wins
+    REQUIRE(obj["spliced"] == 1);
+  }
+
+  SECTION("parseObject()") {
+    std::string json = "{";
+    for (int i = 0; i < 100; i++) json += "\"" + keyOf(i) + "\":0,";
+    json += "\"key0\":1}";
+
+    JsonObject& parsed = jb.parseObject(json);
+    REQUIRE(parsed.size() == 100);
+    REQUIRE(parsed["key0"] == 1);
+    REQUIRE(parsed["key99"] == 0);
+  }
+
+  SECTION("copyCompactly()") {
+    DynamicJsonBuffer compact;
+    JsonObject& copy = compact.copyCompactly(obj);
+    jb.clear();
+
+    for (int i = 0; i < 100; i++) REQUIRE(copy[keyOf(i)] == i);
+    REQUIRE_FALSE(copy.containsKey("key100"));
+  }
+
+  SECTION("when the JsonBuffer is full") {
+    // the keys are not copied, so there is no room for the index
+    const char* keys[] = {"k0", "k1", "k2", "k3", "k4",
+                          "k5", "k6", "k7", "k8", "k9"};
+    StaticJsonBuffer<JSON_OBJECT_SIZE(10)> small;
+    JsonObject& full = small.createObject();
+    for (int i = 0; i < 10; i++) REQUIRE(full.set(keys[i], i));
+
+    for (int i = 0; i < 10; i++) REQUIRE(full[keys[i]] == i);
+    full.remove("k3");
+    REQUIRE_FALSE(full.containsKey("k3"));
+    REQUIRE(full["k9"] == 9);
+  }
+}
@@ -4,6 +4,7 @@
 
 #include <ArduinoJson/Polyfills/isInteger.hpp>
 #include <catch.hpp>
+#include <sstream>
 
 using namespace ArduinoJson::Internals;
 
@@ -33,6 +34,26 @@ TEST_CASE("isInteger()") {
     REQUIRE(isInteger("+42"));
   }
 
+  SECTION("TooBigForJsonUInt") {
+    REQUIRE_FALSE(isInteger("123456789012345678901234567890"));
+    REQUIRE_FALSE(isInteger("-123456789012345678901234567890"));
+  }
+
+  SECTION("TooSmallForJsonInteger") {
+    JsonUInt min = JsonUInt(~JsonUInt(0)) / 2 + 1;
+    std::ostringstream minString;
+    minString << '-' << min;
+    std::ostringstream belowMinString;
+    belowMinString << '-' << min + 1;
+
+    REQUIRE(isInteger(minString.str().c_str()));
+    REQUIRE_FALSE(isInteger(belowMinString.str().c_str()));
+  }
+
+  SECTION("LeadingZeros") {
+    REQUIRE(isInteger("0000000000000000000000000000042"));
+  }
+
   SECTION("ExtraSign") {
     REQUIRE_FALSE(isInteger("--42"));
     REQUIRE_FALSE(isInteger("++42"));
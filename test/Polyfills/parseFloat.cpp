@@ -13,6 +13,12 @@ void check(const char* input, T expected) {
   REQUIRE(parseFloat<T>(input) == Approx(expected));
 }
 
+template <typename T>
+void checkExact(const char* input, T expected) {
+  CAPTURE(input);
+  REQUIRE(parseFloat<T>(input) == expected);
+}
+
 template <typename T>
 void checkNaN(const char* input) {
   CAPTURE(input);
@@ -78,6 +84,14 @@ TEST_CASE("parseFloat<float>()") {
     check<float>("-34028234.66385288611111111111111", -34028234.663852886f);
   }
 
+  SECTION("CorrectlyRounded") {
+    checkExact<float>("516649e-6", 516649e-6f);
+    checkExact<float>("7228.62", 7228.62f);
+    checkExact<float>("0.0798315", 0.0798315f);
+    checkExact<float>("-0.906996", -0.906996f);
+    checkExact<float>("1.5e10", 1.5e10f);
+  }
+
   SECTION("ExponentTooBig") {
     checkInf<float>("1e39", false);
     checkInf<float>("-1e39", true);
@@ -158,6 +172,16 @@ TEST_CASE("parseFloat<double>()") {
     check<double>("-1797693.134862315711111111111111", -1797693.1348623157);
   }
 
+  SECTION("CorrectlyRounded") {
+    checkExact<double>("19885.386", 19885.386);
+    checkExact<double>("3.5005211", 3.5005211);
+    checkExact<double>("1513.929", 1513.929);
+    checkExact<double>("-3457519.8", -3457519.8);
+    checkExact<double>("49798315e-15", 49798315e-15);
+    checkExact<double>("0.1", 0.1);
+    checkExact<double>("1.5e22", 1.5e22);
+  }
+
   SECTION("ExponentTooBig") {
     checkInf<double>("1e309", false);
     checkInf<double>("-1e309", true);
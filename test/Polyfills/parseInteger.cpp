@@ -5,6 +5,7 @@
 #include <stdint.h>
 #include <ArduinoJson/Polyfills/parseInteger.hpp>
 #include <catch.hpp>
+#include <sstream>
 
 using namespace ArduinoJson::Internals;
 
@@ -21,8 +22,8 @@ TEST_CASE("parseInteger<int8_t>()") {
   check<int8_t>("+127", 127);
   check<int8_t>("3.14", 3);
   check<int8_t>("x42", 0);
-  check<int8_t>("128", -128);
-  check<int8_t>("-129", 127);
+  check<int8_t>("128", 0);
+  check<int8_t>("-129", 0);
   check<int8_t>(NULL, 0);
   check<int8_t>("true", 1);
   check<int8_t>("false", 0);
@@ -34,8 +35,8 @@ TEST_CASE("parseInteger<int16_t>()") {
   check<int16_t>("+32767", 32767);
   check<int16_t>("3.14", 3);
   check<int16_t>("x42", 0);
-  check<int16_t>("-32769", 32767);
-  check<int16_t>("32768", -32768);
+  check<int16_t>("-32769", 0);
+  check<int16_t>("32768", 0);
   check<int16_t>(NULL, 0);
   check<int16_t>("true", 1);
   check<int16_t>("false", 0);
@@ -47,8 +48,8 @@ TEST_CASE("parseInteger<int32_t>()") {
   check<int32_t>("+2147483647", 2147483647);
   check<int32_t>("3.14", 3);
   check<int32_t>("x42", 0);
-  check<int32_t>("-2147483649", 2147483647);
-  check<int32_t>("2147483648", (-2147483647 - 1));
+  check<int32_t>("-2147483649", 0);
+  check<int32_t>("2147483648", 0);
   check<int32_t>("true", 1);
   check<int32_t>("false", 0);
 }
@@ -59,7 +60,8 @@ TEST_CASE("parseInteger<uint8_t>()") {
   check<uint8_t>("+255", 255);
   check<uint8_t>("3.14", 3);
   check<uint8_t>("x42", 0);
-  check<uint8_t>("-1", 255);
+  check<uint8_t>("-1", 0);
+  check<uint8_t>("-0", 0);
   check<uint8_t>("256", 0);
   check<uint8_t>("true", 1);
   check<uint8_t>("false", 0);
@@ -72,8 +74,39 @@ TEST_CASE("parseInteger<uint16_t>()") {
   check<uint16_t>("3.14", 3);
   // check<uint16_t>(" 42", 0);
   check<uint16_t>("x42", 0);
-  check<uint16_t>("-1", 65535);
+  check<uint16_t>("-1", 0);
   check<uint16_t>("65536", 0);
   check<uint16_t>("true", 1);
   check<uint16_t>("false", 0);
 }
+
+TEST_CASE("parseInteger<JsonUInt>()") {
+  const JsonUInt max = JsonUInt(~JsonUInt(0));
+  std::ostringstream maxString;
+  maxString << max;
+
+  check<JsonUInt>(maxString.str().c_str(), max);
+  check<JsonUInt>((maxString.str() + ".5").c_str(), max);
+  check<JsonUInt>(("-" + maxString.str()).c_str(), 0);
+  check<JsonUInt>((maxString.str() + "0").c_str(), 0);
+  check<JsonUInt>(
+      sizeof(JsonUInt) == 8 ? "18446744073709551616" : "4294967296", 0);
+  check<JsonUInt>("123456789012345678901234567890", 0);
+  check<JsonUInt>("-123456789012345678901234567890", 0);
+  check<JsonUInt>("0000000000000000000000000000042", 42);
+}
+
+TEST_CASE("parseInteger<JsonInteger>()") {
+  const JsonInteger max = JsonInteger(JsonUInt(~JsonUInt(0)) / 2);
+  const JsonInteger min = -max - 1;
+  std::ostringstream maxString, minString, aboveMaxString, belowMinString;
+  maxString << max;
+  minString << min;
+  aboveMaxString << JsonUInt(max) + 1;
+  belowMinString << "-" << JsonUInt(max) + 2;
+
+  check<JsonInteger>(maxString.str().c_str(), max);
+  check<JsonInteger>(minString.str().c_str(), min);
+  check<JsonInteger>(aboveMaxString.str().c_str(), 0);
+  check<JsonInteger>(belowMinString.str().c_str(), 0);
+}
@@ -34,6 +34,26 @@ TEST_CASE("StaticJsonBuffer::startString()") {
     REQUIRE(0 == str.c_str());
   }
 
+  SECTION("AppendsSpans") {
+    StaticJsonBuffer<6> jsonBuffer;
+
+    StaticJsonBufferBase::String str = jsonBuffer.startString();
+    str.append("he", 2);
+    str.append("llo", 3);
+
+    REQUIRE(std::string("hello") == str.c_str());
+  }
+
+  SECTION("ReturnsNullWhenSpanIsTooBig") {
+    StaticJsonBuffer<5> jsonBuffer;
+
+    StaticJsonBufferBase::String str = jsonBuffer.startString();
+    str.append("hello world", 11);
+
+    REQUIRE(0 == str.c_str());
+    REQUIRE(5 == jsonBuffer.size());
+  }
+
   SECTION("SizeIncreases") {
     StaticJsonBuffer<5> jsonBuffer;
 
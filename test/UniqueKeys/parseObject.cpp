@@ -0,0 +1,49 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#define ARDUINOJSON_ASSUME_UNIQUE_KEYS 1
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("ARDUINOJSON_ASSUME_UNIQUE_KEYS") {
+  DynamicJsonBuffer jb;
+
+  SECTION("Keeps the order of the keys") {
+    JsonObject& obj = jb.parseObject("{\"a\":1,\"b\":2,\"c\":3}");
+    REQUIRE(obj.success());
+    REQUIRE(obj.size() == 3);
+
+    JsonObject::iterator it = obj.begin();
+    REQUIRE(it->key == std::string("a"));
+    ++it;
+    REQUIRE(it->key == std::string("b"));
+    ++it;
+    REQUIRE(it->key == std::string("c"));
+  }
+
+  SECTION("Duplicate keys give duplicate pairs") {
+    JsonObject& obj = jb.parseObject("{\"a\":1,\"a\":2}");
+    REQUIRE(obj.success());
+    REQUIRE(obj.size() == 2);
+    REQUIRE(obj["a"] == 1);
+  }
+
+  SECTION("set() still replaces the value") {
+    JsonObject& obj = jb.parseObject("{\"a\":1}");
+    obj.set("a", 2);
+    REQUIRE(obj.size() == 1);
+    REQUIRE(obj["a"] == 2);
+  }
+
+  SECTION("validateJson() counts the duplicates") {
+    char json[] = "{\"a\":1,\"a\":2}";
+    size_t size = 0;
+    REQUIRE(validateJson(json, &size));
+
+    DynamicJsonBuffer buffer;
+    buffer.parseObject(json);
+    REQUIRE(size == buffer.size());
+  }
+}